@@ -0,0 +1,127 @@
+#define _DEFAULT_SOURCE  // For getline
+
+#include <err.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "batch.h"
+
+typedef struct {
+	batch const *batch;
+	batch_run_function *run;
+	void *context;
+	atomic_size_t next;  // Index of the next input for a worker to take
+	atomic_bool failed;
+} batch_state;
+
+/*
+ * Reads the names of the inputs, one per line.
+ */
+void batch_read_inputs(batch *batch, FILE *from) {
+	size_t alloc = 0;
+	char *line = NULL;
+	size_t line_alloc = 0;
+	ssize_t len;
+	while ((len = getline(&line, &line_alloc, from)) != -1) {
+		if (len && line[len - 1] == '\n')
+			line[--len] = '\0';
+		if (!len)
+			continue;
+
+		if (batch->count == alloc) {
+			alloc = alloc ? alloc * 2 : 64;
+			batch->inputs = realloc(batch->inputs, alloc * sizeof *batch->inputs);
+		}
+		batch->inputs[batch->count++] = strdup(line);
+	}
+	free(line);
+}
+
+void batch_free(batch *batch) {
+	for (size_t i = 0; i < batch->count; i++)
+		free(batch->inputs[i]);
+	free(batch->inputs);
+}
+
+/*
+ * Runs the program against one input, writing its output to the input's name
+ * with BATCH_OUTPUT_SUFFIX on the end.
+ */
+static bool run_input(batch_state *state, char const *input) {
+	int in_fd = open(input, O_RDONLY);
+	if (in_fd < 0) {
+		warn("Can't open input %s", input);
+		return false;
+	}
+
+	size_t input_len = strlen(input);
+	char *output = malloc(input_len + sizeof BATCH_OUTPUT_SUFFIX);
+	memcpy(output, input, input_len);
+	memcpy(output + input_len, BATCH_OUTPUT_SUFFIX, sizeof BATCH_OUTPUT_SUFFIX);
+	int out_fd = open(output, O_WRONLY | O_CREAT | O_TRUNC, 0666);
+	if (out_fd < 0) {
+		warn("Can't create output %s", output);
+		free(output);
+		close(in_fd);
+		return false;
+	}
+
+	state->run(state->context, in_fd, out_fd);
+
+	bool ok = !close(out_fd);
+	if (!ok)
+		warn("Can't write output %s", output);
+	close(in_fd);
+	free(output);
+	return ok;
+}
+
+static void *batch_worker(void *arg) {
+	batch_state *state = arg;
+	size_t i;
+	while ((i = atomic_fetch_add(&state->next, 1)) < state->batch->count) {
+		if (!run_input(state, state->batch->inputs[i]))
+			atomic_store(&state->failed, true);
+	}
+	return NULL;
+}
+
+/*
+ * Runs every input on a pool of batch->jobs threads, returning whether they
+ * all ran.  Inputs are handed out one at a time as threads become free, so a
+ * few slow ones don't hold up the rest.
+ */
+bool run_batch(batch const *batch, batch_run_function *run, void *context) {
+	batch_state state = {
+		.batch = batch,
+		.run = run,
+		.context = context,
+	};
+	atomic_init(&state.next, 0);
+	atomic_init(&state.failed, false);
+
+	unsigned jobs = batch->jobs;
+	if (jobs > batch->count)
+		jobs = batch->count;
+
+	// This thread is one of the workers
+	pthread_t *threads = malloc(jobs * sizeof *threads);
+	unsigned started = 0;
+	for (; started + 1 < jobs; started++) {
+		int error = pthread_create(&threads[started], NULL, batch_worker, &state);
+		if (error) {
+			warnx("Can't start a thread: %s", strerror(error));
+			break;
+		}
+	}
+	batch_worker(&state);
+
+	for (unsigned i = 0; i < started; i++)
+		pthread_join(threads[i], NULL);
+	free(threads);
+	return !atomic_load(&state.failed);
+}
@@ -0,0 +1,28 @@
+#ifndef USING_BATCH_H
+#define USING_BATCH_H
+
+/*
+ * Running one program against many inputs at once for --batch.  The program
+ * is only compiled once; each input is then run on one of a pool of threads,
+ * with its own tape and I/O, and its output written next to it.  (Shared
+ * between variants.)
+ */
+#include <stdbool.h>
+#include <stdio.h>
+
+#define BATCH_OUTPUT_SUFFIX ".out"
+
+typedef struct {
+	char **inputs;
+	size_t count;
+	unsigned jobs;
+} batch;
+
+// Runs a program with input from in_fd and output to out_fd
+typedef void batch_run_function(void *context, int in_fd, int out_fd);
+
+void batch_read_inputs(batch *batch, FILE *from);
+void batch_free(batch *batch);
+bool run_batch(batch const *batch, batch_run_function *run, void *context);
+
+#endif
@@ -3,33 +3,132 @@
  * allocate/deallocate parts of the tree.
  */
 #include <assert.h>
+#include <err.h>
+#include <stddef.h>
 #include <string.h>
 #include <stdio.h>
 
 #include "brainfuck.h"
 
+#define BF_ARENA_BLOCK_BYTES 65536
+// Most loops are small, and what they don't use is wasted until the end
+#define BF_OPS_FIRST_ALLOC 8
+#define BF_ARENA_ALIGN (sizeof(max_align_t))
+
+struct bf_arena_block {
+	bf_arena_block *previous;
+	max_align_t data[];
+};
+
+static size_t arena_round(size_t bytes) {
+	return (bytes + BF_ARENA_ALIGN - 1) & ~(BF_ARENA_ALIGN - 1);
+}
+
+// Only the latest allocation ends where the free space starts
+static bool arena_is_latest(bf_arena *arena, void *ptr, size_t bytes) {
+	return ptr && (char*)ptr + arena_round(bytes) == arena->next;
+}
+
+void *bf_arena_alloc(bf_arena *arena, size_t bytes) {
+	assert(arena != NULL);
+	bytes = arena_round(bytes);
+
+	if (!arena->next || (size_t)(arena->end - arena->next) < bytes) {
+		size_t size = bytes > BF_ARENA_BLOCK_BYTES ? bytes : BF_ARENA_BLOCK_BYTES;
+		bf_arena_block *block = malloc(sizeof *block + size);
+		if (!block)
+			err(1, "Can't allocate memory for the program");
+		block->previous = arena->blocks;
+		arena->blocks = block;
+		arena->next = (char*)block->data;
+		arena->end = arena->next + size;
+	}
+
+	void *allocated = arena->next;
+	arena->next += bytes;
+	return allocated;
+}
+
+/*
+ * Like realloc, except that the old space is only given back if it was the
+ * latest allocation (as it usually is, for the loop being parsed).  Shrinking
+ * never moves anything.
+ */
+void *bf_arena_resize(bf_arena *arena, void *ptr, size_t old_bytes, size_t new_bytes) {
+	assert(arena != NULL);
+	if (arena_is_latest(arena, ptr, old_bytes) && (size_t)(arena->end - (char*)ptr) >= arena_round(new_bytes)) {
+		arena->next = (char*)ptr + arena_round(new_bytes);
+		return ptr;
+	}
+	if (new_bytes <= old_bytes)
+		return ptr;
+
+	void *moved = bf_arena_alloc(arena, new_bytes);
+	if (ptr)
+		memcpy(moved, ptr, old_bytes);
+	return moved;
+}
+
+// Gives back an allocation which nothing uses any more, if it was the latest
+void bf_arena_release(bf_arena *arena, void *ptr, size_t bytes) {
+	if (arena_is_latest(arena, ptr, bytes))
+		arena->next = ptr;
+}
+
+void bf_arena_free(bf_arena *arena) {
+	while (arena->blocks) {
+		bf_arena_block *previous = arena->blocks->previous;
+		free(arena->blocks);
+		arena->blocks = previous;
+	}
+	*arena = (bf_arena) {0};
+}
+
+/*
+ * Makes room for another frame on an explicit stack, used to walk the tree
+ * without recursing once per level of nesting.  The stack starts off in a
+ * fixed buffer and moves to the heap if it outgrows it.
+ */
+void *grow_stack(void *stack, void const *fixed, size_t *alloc, size_t frame_size) {
+	size_t new_alloc = *alloc * 2;
+	void *grown;
+	if (stack == fixed) {
+		grown = malloc(new_alloc * frame_size);
+		if (grown)
+			memcpy(grown, stack, *alloc * frame_size);
+	} else {
+		grown = realloc(stack, new_alloc * frame_size);
+	}
+	if (!grown)
+		err(1, "Can't allocate memory for the program");
+	*alloc = new_alloc;
+	return grown;
+}
+
+static void resize_bf_ops(bf_op_builder *ops, size_t alloc) {
+	ops->ops = bf_arena_resize(ops->arena, ops->ops, ops->alloc * sizeof *ops->ops, alloc * sizeof *ops->ops);
+	ops->alloc = alloc;
+}
+
 bf_op* alloc_bf_op(bf_op_builder *ops) {
 	assert(ops != NULL);
-	assert(ops->ops != NULL);
-	assert(ops->alloc != 0);
+	assert(ops->arena != NULL);
 
-	if (ops->len == ops->alloc) {
-		ops->alloc *= 2;
-		ops->ops = realloc(ops->ops, ops->alloc * sizeof *ops->ops);
-	}
+	if (ops->len == ops->alloc)
+		resize_bf_ops(ops, ops->alloc ? ops->alloc * 2 : BF_OPS_FIRST_ALLOC);
 	return &ops->ops[ops->len++];
 }
 
 bf_op* insert_bf_ops(bf_op_builder *ops, size_t index, size_t count) {
 	assert(ops != NULL);
-	assert(ops->ops != NULL);
-	assert(ops->alloc != 0);
+	assert(ops->arena != NULL);
 
 	if (ops->len + count > ops->alloc) {
-		while (ops->len + count > ops->alloc) {
-			ops->alloc *= 2;
+		size_t alloc = ops->alloc ? ops->alloc : BF_OPS_FIRST_ALLOC;
+		while (ops->len + count > alloc) {
+			alloc *= 2;
 		}
-		ops->ops = realloc(ops->ops, ops->alloc * sizeof *ops->ops);
+		resize_bf_ops(ops, alloc);
 	}
 
 	memmove(ops->ops + index + count, ops->ops + index, (ops->len - index) * sizeof *ops->ops);
@@ -37,32 +136,36 @@ bf_op* insert_bf_ops(bf_op_builder *ops, size_t index, size_t count) {
 	return &ops->ops[index];
 }
 
+// The ops' children stay in the arena until the whole tree is freed
 void remove_bf_ops(bf_op_builder *arr, size_t index, size_t count) {
 	assert(arr != NULL);
 	assert(arr->ops != NULL);
 	assert(index + count <= arr->len);
 
-	for (size_t i = index; i < index + count; i++) {
-		free_bf_op_children(&arr->ops[i]);
-	}
 	memmove(arr->ops + index, arr->ops + index + count,
 			(arr->len - index - count) * sizeof *arr->ops);
 	arr->len -= count;
 }
 
-void free_bf_op_children(bf_op *op) {
-	switch (op->op_type) {
-		case BF_OP_LOOP:
-		case BF_OP_ONCE: {
-			size_t children = op->children.len;
-			for (size_t i = 0; i < children; i++)
-				free_bf_op_children(&op->children.ops[i]);
-			free(op->children.ops);
-			break;
-		}
+static bool source_before(uint32_t line_a, uint32_t column_a, uint32_t line_b, uint32_t column_b) {
+	return line_a < line_b || (line_a == line_b && column_a < column_b);
+}
 
-		default:
-			// Everything else is fine
-			break;
+/*
+ * Gets the smallest range covering both of the given ones, either of which may
+ * be empty.
+ */
+source_range source_range_union(source_range a, source_range b) {
+	if (!a.first_line) return b;
+	if (!b.first_line) return a;
+
+	if (source_before(b.first_line, b.first_column, a.first_line, a.first_column)) {
+		a.first_line = b.first_line;
+		a.first_column = b.first_column;
+	}
+	if (source_before(a.last_line, a.last_column, b.last_line, b.last_column)) {
+		a.last_line = b.last_line;
+		a.last_column = b.last_column;
 	}
+	return a;
 }
@@ -6,6 +6,8 @@
 #include <sys/types.h>
 #include <stdlib.h>
 
+#include "variant.h"
+
 enum bf_op_type {
 	                      // ┏━━━━ opcode is used in final Flattened representation
 	                      // ┃┏━━━ opcode is generated by Optimizer
@@ -26,6 +28,21 @@ enum bf_op_type {
 	BF_OP_JUMPIFNONZERO,  // F    jump if nonzero (used to implement the loop)
 	BF_OP_JUMPIFZERO,     // F    jump if zero (used to implement the loop)
 	BF_OP_DIE,            // F  U a pseudo-op signalling the end of the program
+	BF_OP_NATIVE_LOOP,    // F  U a JUMPIFNONZERO whose loop has been compiled to native code (only while tiered execution is running)
+	BF_OP_MOVE_MULTIPLY,  // F    an ALTER_MOVEONLY fused with the MULTIPLY after it
+	BF_OP_MOVE_JUMPIFNONZERO, // F    an ALTER_MOVEONLY fused with the JUMPIFNONZERO after it
+	BF_OP_MOVE_NATIVE_LOOP,   // F  U a MOVE_JUMPIFNONZERO whose loop has been compiled to native code (only while tiered execution is running)
+	BF_OP_DIVIDE,         // FO   replace the data at the data pointer with how many times a loop stepping it by an even amount runs
+	BF_OP_PRODUCT,        // FO   multiply current data by the data at another offset, and add it to a third
+	BF_OP_ADD_AT,         // FO   modify the data at an offset from the data pointer, without moving it
+	BF_OP_WRITE_CONST,    // FO U output a string which was known when compiling
+	BF_OP_CLEAR_RUN,      // FO   clear cells until a zero is reached. optimization of loops like [[-]>]
+	BF_OP_SHIFT_RUN,      // FO   move cells along by a distance until a zero is reached. optimization of loops like [[->+<]<]
+	BF_OP_SET_AT,         // FO   set the data at an offset from the data pointer, without moving it
+	BF_OP_IN_AT,          // FO   take a character on input, store at an offset from the data pointer
+	BF_OP_OUT_AT,         // FO   output the character at an offset from the data pointer
+
+	BF_OP_COUNT           //      not an opcode: the number of opcodes above
 };
 
 #ifndef CELL_INT
@@ -34,12 +51,30 @@ enum bf_op_type {
 
 typedef CELL_INT cell_int;
 
+// Part of the brainfuck source, with lines and columns counted from 1 (all zero for none)
+typedef struct {
+	uint32_t first_line, first_column;
+	uint32_t last_line, last_column;
+} source_range;
+
 struct s_bf_op;
 
+/*
+ * Where the tree is allocated from: blocks which are bumped through and only
+ * ever freed all at once, once the tree has been flattened.
+ */
+typedef struct bf_arena_block bf_arena_block;
+
 typedef struct {
-	struct s_bf_op *ops;
+	bf_arena_block *blocks;  // The newest first
+	char *next, *end;  // The free part of the newest block
+} bf_arena;
+
+typedef struct {
+	struct s_bf_op *ops;  // From the arena, and NULL until the first op
 	size_t len;
 	size_t alloc;
+	bf_arena *arena;
 } bf_op_builder;
 
 typedef struct {
@@ -58,6 +93,8 @@ typedef struct s_bf_op {
 	bool definitely_zero : 1;
 	bool definitely_nonzero : 1;
 
+	source_range source;  // Where the op came from, from its first character to its last
+
 	union {
 		struct {
 			bf_op_builder children;  // Applies to LOOPs and ONCE only
@@ -66,6 +103,13 @@ typedef struct s_bf_op {
 		struct { // Applies to most things but notably not LOOPs or ONCE
 			ssize_t offset;
 			cell_int amount;
+			// Applies to PRODUCTs, as the offset of the other cell multiplied
+			// by, and SHIFT_RUNs, as how far each cell moves, only
+			ssize_t factor;
+		};
+		struct {  // Applies to WRITE_CONSTs only
+			char const *text;  // From the arena
+			size_t text_length;
 		};
 	};
 } bf_op;
@@ -73,6 +117,11 @@ typedef struct s_bf_op {
 bf_op* alloc_bf_op(bf_op_builder *ops);
 bf_op* insert_bf_ops(bf_op_builder *ops, size_t index, size_t count);
 void remove_bf_ops(bf_op_builder *arr, size_t index, size_t count);
-void free_bf_op_children(bf_op *op);
+void *bf_arena_alloc(bf_arena *arena, size_t bytes);
+void *bf_arena_resize(bf_arena *arena, void *ptr, size_t old_bytes, size_t new_bytes);
+void bf_arena_release(bf_arena *arena, void *ptr, size_t bytes);
+void bf_arena_free(bf_arena *arena);
+void *grow_stack(void *stack, void const *fixed, size_t *alloc, size_t frame_size);
+source_range source_range_union(source_range a, source_range b);
 
 #endif
@@ -0,0 +1,236 @@
+#define _DEFAULT_SOURCE  // For pread
+
+#include <err.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+
+#include "bytecode_file.h"
+
+#define FNV_OFFSET_BASIS 0xcbf29ce484222325u
+#define FNV_PRIME 0x100000001b3u
+#define MIX_MULTIPLIER 0x9e3779b97f4a7c15u
+
+enum map_result {
+	MAP_NOT_BYTECODE,
+	MAP_OK,
+	MAP_BAD,  // Bytecode, but not any which can be run, for the reason given
+};
+
+static enum map_result map_bytecode(FILE *file, bytecode_file *loaded, char *problem, size_t problem_size) {
+	int fd = fileno(file);
+	bytecode_header header;
+	if (pread(fd, &header, sizeof header, 0) != sizeof header || memcmp(header.magic, BYTECODE_MAGIC, sizeof header.magic))
+		return MAP_NOT_BYTECODE;
+
+	struct stat st;
+	if (header.version != BYTECODE_VERSION) {
+		snprintf(problem, problem_size, "The bytecode file is version %u, but this reads version %u",
+				(unsigned)header.version, BYTECODE_VERSION);
+		return MAP_BAD;
+	}
+	if (header.word_bits != CHAR_BIT * sizeof(ssize_t)) {
+		snprintf(problem, problem_size, "The bytecode file was written on a machine with %u-bit words", (unsigned)header.word_bits);
+		return MAP_BAD;
+	}
+	if (fstat(fd, &st)) {
+		snprintf(problem, problem_size, "Can't read the bytecode file: %s", strerror(errno));
+		return MAP_BAD;
+	}
+	if ((uint64_t)st.st_size - sizeof header < header.length) {
+		snprintf(problem, problem_size, "The bytecode file is truncated");
+		return MAP_BAD;
+	}
+
+	// Private, so that tiering can patch it without touching the file
+	void *mapping = mmap(NULL, st.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+	if (mapping == MAP_FAILED) {
+		snprintf(problem, problem_size, "Can't map the bytecode file: %s", strerror(errno));
+		return MAP_BAD;
+	}
+
+	*loaded = (bytecode_file) {
+		.header = mapping,
+		.bytecode = (char*)mapping + sizeof header,
+		.mapping = mapping,
+		.mapping_size = st.st_size,
+	};
+	return MAP_OK;
+}
+
+/*
+ * Maps a bytecode file in, if the file is one.  Returns false if it doesn't
+ * start like one, and gives up if it does but can't be run.
+ */
+bool bytecode_file_map(FILE *file, bytecode_file *loaded) {
+	char problem[128];
+	enum map_result result = map_bytecode(file, loaded, problem, sizeof problem);
+	if (result == MAP_BAD)
+		errx(1, "%s", problem);
+	return result == MAP_OK;
+}
+
+void bytecode_file_unmap(bytecode_file *loaded) {
+	if (loaded->mapping)
+		munmap(loaded->mapping, loaded->mapping_size);
+	*loaded = (bytecode_file) {0};
+}
+
+/*
+ * Writes the bytecode out.  It goes to a temporary file first, which is then
+ * renamed into place, so that nothing ever sees half of it.
+ */
+bool bytecode_file_write(char const *path, bytecode_header header, char const *bytecode) {
+	memcpy(header.magic, BYTECODE_MAGIC, sizeof header.magic);
+	header.version = BYTECODE_VERSION;
+	header.word_bits = CHAR_BIT * sizeof(ssize_t);
+
+	size_t path_len = strlen(path);
+	char *temp = malloc(path_len + 32);
+	snprintf(temp, path_len + 32, "%s.%ld.tmp", path, (long)getpid());
+
+	FILE *out = fopen(temp, "wb");
+	if (!out) {
+		warn("Can't create %s", temp);
+		free(temp);
+		return false;
+	}
+	bool ok = fwrite(&header, sizeof header, 1, out) == 1
+		&& fwrite(bytecode, 1, header.length, out) == header.length;
+	ok = !fclose(out) && ok;
+	if (ok && rename(temp, path))
+		ok = false;
+	if (!ok) {
+		warn("Can't write %s", path);
+		unlink(temp);
+	}
+
+	free(temp);
+	return ok;
+}
+
+bool bytecode_tape_compatible(enum tape_kind compiled, enum tape_kind running) {
+	// Only a tape grown with realloc needs bounds checks
+	bool compiled_vm = compiled == TAPE_VM || compiled == TAPE_VM_HUGE;
+	bool running_vm = running == TAPE_VM || running == TAPE_VM_HUGE;
+	return compiled == running || (compiled_vm && running_vm);
+}
+
+static uint64_t hash_bytes(uint64_t hash, void const *data, size_t len) {
+	unsigned char const *bytes = data;
+	for (size_t i = 0; i < len; i++) {
+		hash ^= bytes[i];
+		hash *= FNV_PRIME;
+	}
+	return hash;
+}
+
+// A second hash of the source, which works differently enough from FNV not to clash with it as well
+static uint64_t mix_bytes(uint64_t hash, void const *data, size_t len) {
+	unsigned char const *bytes = data;
+	for (size_t i = 0; i < len; i++) {
+		hash = (hash + bytes[i] + 1) * MIX_MULTIPLIER;
+		hash ^= hash >> 31;
+	}
+	return hash;
+}
+
+/*
+ * $XDG_CACHE_HOME/brainfuck, or ~/.cache/brainfuck
+ */
+char *cache_default_dir(void) {
+	char const *base = getenv("XDG_CACHE_HOME"), *suffix = "/brainfuck";
+	if (!base || !*base) {
+		base = getenv("HOME");
+		suffix = "/.cache/brainfuck";
+		if (!base || !*base)
+			return NULL;
+	}
+
+	size_t len = strlen(base) + strlen(suffix) + 1;
+	char *dir = malloc(len);
+	snprintf(dir, len, "%s%s", base, suffix);
+	return dir;
+}
+
+// Makes the directory, and any parents of it which are missing
+static void make_dirs(char *path) {
+	for (char *slash = strchr(path + 1, '/'); ; slash = strchr(slash + 1, '/')) {
+		if (slash)
+			*slash = '\0';
+		if (mkdir(path, 0777) && errno != EEXIST)
+			warn("Can't create the cache directory %s", path);
+		if (!slash)
+			return;
+		*slash = '/';
+	}
+}
+
+/*
+ * Looks the source up in the cache, returning the path of its bytecode file.
+ * If it's there, it's mapped into loaded; otherwise, loaded is left empty and
+ * the bytecode should be written to the path once it has been compiled, with
+ * the source_id filled in here.  A file which is damaged, or which turns out
+ * to be of some other source, is a miss, and gets written over.  The source is
+ * left rewound.  Returns NULL if there's no cache to use.
+ */
+char *cache_lookup(char const *dir, FILE *source, int cell_bits, enum tape_kind tape_kind, uint64_t eval_steps,
+		pass_pipeline const *pipeline, bytecode_source *source_id, bytecode_file *loaded) {
+	*loaded = (bytecode_file) {0};
+	*source_id = (bytecode_source) {0};
+
+	uint64_t hash = FNV_OFFSET_BASIS;
+	char buffer[65536];
+	size_t got;
+	while ((got = fread(buffer, 1, sizeof buffer, source))) {
+		hash = hash_bytes(hash, buffer, got);
+		source_id->hash = mix_bytes(source_id->hash, buffer, got);
+		source_id->length += got;
+	}
+	bool read_ok = !ferror(source);
+	rewind(source);
+	if (!read_ok)
+		return NULL;
+
+	// The rest of the key: anything else which changes the bytecode
+	uint32_t version = BYTECODE_VERSION;
+	uint8_t config[2] = {cell_bits, (tape_kind == TAPE_VM_HUGE ? TAPE_VM : tape_kind)};
+	hash = hash_bytes(hash, &version, sizeof version);
+	hash = hash_bytes(hash, config, sizeof config);
+	hash = hash_bytes(hash, &eval_steps, sizeof eval_steps);
+	uint64_t pass_count = pipeline->len, rounds = pipeline->rounds;
+	hash = hash_bytes(hash, &pass_count, sizeof pass_count);
+	hash = hash_bytes(hash, pipeline->passes, pipeline->len);
+	hash = hash_bytes(hash, &rounds, sizeof rounds);
+	// A rebuilt executable may optimize differently
+	struct stat exe;
+	if (!stat("/proc/self/exe", &exe)) {
+		hash = hash_bytes(hash, &exe.st_size, sizeof exe.st_size);
+		hash = hash_bytes(hash, &exe.st_mtime, sizeof exe.st_mtime);
+	}
+
+	char *dir_copy = strdup(dir);
+	make_dirs(dir_copy);
+	free(dir_copy);
+
+	size_t len = strlen(dir) + 32;
+	char *path = malloc(len);
+	snprintf(path, len, "%s/%016llx.bfc", dir, (unsigned long long)hash);
+
+	FILE *cached = fopen(path, "rb");
+	if (cached) {
+		char problem[128];
+		if (map_bytecode(cached, loaded, problem, sizeof problem) == MAP_OK
+				&& (loaded->header->cell_bits != cell_bits || !bytecode_tape_compatible(loaded->header->tape_kind, tape_kind)
+					|| memcmp(&loaded->header->source, source_id, sizeof *source_id)))
+			bytecode_file_unmap(loaded);
+		fclose(cached);
+	}
+	return path;
+}
@@ -0,0 +1,64 @@
+#ifndef USING_BYTECODE_FILE_H
+#define USING_BYTECODE_FILE_H
+
+/*
+ * Flattened programs saved to disk, either with --emit-bytecode or in the
+ * compile cache, so that they can be run again without parsing or optimizing
+ * them.  A file is a header followed by the bytecode, and is mapped straight
+ * into memory to be run.  (Shared between variants.)
+ *
+ * The bytecode is trusted: beyond the header, nothing checks that it's valid.
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <sys/types.h>
+
+#include "interpreter.h"
+#include "passes.h"
+
+#define BYTECODE_MAGIC "BFBYTES"
+// Bump whenever the bytecode or the header changes
+#define BYTECODE_VERSION 8
+
+// The source a program was compiled from, as far as the cache can tell (all zero if unknown)
+typedef struct {
+	uint64_t length;
+	uint64_t hash;  // Not the hash the cache file is named after, so that both have to clash
+} bytecode_source;
+
+typedef struct {
+	char magic[8];
+	uint32_t version;
+	uint8_t cell_bits;
+	uint8_t word_bits;  // Of OPERAND_WORD offsets
+	uint8_t tape_kind;  // Which decides whether the bytecode has bounds checks
+	uint8_t reserved;
+	int64_t lowest_negative_skip, highest_positive_skip;
+	uint64_t length;  // Of the bytecode after the header, in bytes
+	bytecode_source source;
+} bytecode_header;
+
+typedef struct {
+	bytecode_header const *header;
+	char *bytecode;  // Copy on write, for --tiered
+	void *mapping;
+	size_t mapping_size;
+} bytecode_file;
+
+bool bytecode_file_map(FILE *file, bytecode_file *loaded);
+void bytecode_file_unmap(bytecode_file *loaded);
+bool bytecode_file_write(char const *path, bytecode_header header, char const *bytecode);
+
+// Whether bytecode for one kind of tape can run on another
+bool bytecode_tape_compatible(enum tape_kind compiled, enum tape_kind running);
+
+/*
+ * The compile cache for --cache, a directory of bytecode files named after a
+ * hash of the source and of everything else which decides the bytecode.
+ */
+char *cache_default_dir(void);
+char *cache_lookup(char const *dir, FILE *source, int cell_bits, enum tape_kind tape_kind, uint64_t eval_steps,
+		pass_pipeline const *pipeline, bytecode_source *source_id, bytecode_file *loaded);
+
+#endif
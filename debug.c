@@ -1,18 +1,41 @@
 #include <err.h>
+#include <inttypes.h>
 #include <stdbool.h>
 #include <stdio.h>
 
 #include "debug.h"
 #include "optimizer_helpers.h"
+#include "flattener.h"
+
+// How deep loops can nest before the printer's stack moves to the heap
+#define PRINT_STACK_FIXED 32
+
+typedef struct {
+	bf_op *op;  // A LOOP or the ONCE
+	size_t next_child;
+	int indent;  // Of its children
+} print_frame;
+
+// Prints text in double quotes, escaped as in C
+static void print_text(char const *text, size_t length) {
+	putchar('"');
+	for (size_t i = 0; i < length; i++) {
+		unsigned char c = text[i];
+		if (c == '\n')
+			printf("\\n");
+		else if (c == '"' || c == '\\')
+			printf("\\%c", c);
+		else if (c >= ' ' && c < 0x7F)
+			putchar(c);
+		else
+			printf("\\x%02x", c);
+	}
+	putchar('"');
+}
 
-void print_bf_op(bf_op *op, int indent) {
+// Prints any op but a LOOP or the ONCE
+static void print_leaf_op(bf_op *op) {
 	switch (op->op_type) {
-		case BF_OP_ONCE:
-			for (size_t i = 0; i < op->children.len; i++)
-				print_bf_op(op->children.ops + i, indent);
-			putchar('\n');
-			break;
-
 #ifndef FIXED_TAPE_SIZE
 		case BF_OP_BOUNDS_CHECK:
 			printf("BOUND[%zd] ", op->offset);
@@ -38,10 +61,22 @@ void print_bf_op(bf_op *op, int indent) {
 			printf("SET%d,+%zd ", (int)op->amount, op->offset);
 			break;
 
+		case BF_OP_ADD_AT:
+			printf("@%zd_%+d ", op->offset, (int)op->amount);
+			break;
+
+		case BF_OP_SET_AT:
+			printf("@%zd=%d ", op->offset, (int)op->amount);
+			break;
+
 		case BF_OP_MULTIPLY:
 			printf("*%d_@%zd ", (int)op->amount, op->offset);
 			break;
 
+		case BF_OP_PRODUCT:
+			printf("*%d*@%zd_@%zd ", (int)op->amount, op->factor, op->offset);
+			break;
+
 		case BF_OP_IN:
 			printf(", ");
 			break;
@@ -50,58 +85,222 @@ void print_bf_op(bf_op *op, int indent) {
 			printf(". ");
 			break;
 
-		case BF_OP_LOOP:
-			printf("[\n%*s", indent += 2, "");
-			for (size_t i = 0; i < op->children.len; i++) {
-				print_bf_op(op->children.ops + i, indent);
-			}
-			indent -= 2;
-			printf("\n%*s] (uncertainties: ", indent, "");
-			loop_info info = get_loop_info(op);
-			if (info.uncertain_backwards) putchar('<');
-			if (info.uncertain_forwards) putchar('>');
-			printf(")\n%*s", indent, "");
+		case BF_OP_IN_AT:
+			printf("@%zd, ", op->offset);
+			break;
+
+		case BF_OP_OUT_AT:
+			printf("@%zd. ", op->offset);
+			break;
+
+		case BF_OP_WRITE_CONST:
+			printf("WRITE");
+			print_text(op->text, op->text_length);
+			putchar(' ');
 			break;
 
 		case BF_OP_SKIP:
 			printf("S%zd ", op->offset);
 			break;
 
+		case BF_OP_CLEAR_RUN:
+			printf("C%zd ", op->offset);
+			break;
+
+		case BF_OP_SHIFT_RUN:
+			printf("M%zd_@%zd ", op->offset, op->factor);
+			break;
+
+		case BF_OP_DIVIDE:
+			printf("/%d ", (int)op->amount);
+			break;
+
 		default:
 			errx(1, "Invalid internal state");
 	}
 }
 
-void print_flattened(char *restrict opcodes) {
+static print_frame open_print_frame(bf_op *op, int indent) {
+	if (op->op_type == BF_OP_LOOP)
+		printf("[\n%*s", indent += 2, "");
+	return (print_frame) {.op = op, .indent = indent};
+}
+
+static void close_print_frame(print_frame const *frame) {
+	if (frame->op->op_type == BF_OP_ONCE) {
+		putchar('\n');
+		return;
+	}
+
+	int indent = frame->indent - 2;
+	printf("\n%*s] (uncertainties: ", indent, "");
+	loop_info info = get_loop_info(frame->op);
+	if (info.uncertain_backwards) putchar('<');
+	if (info.uncertain_forwards) putchar('>');
+	printf(")\n%*s", indent, "");
+}
+
+/*
+ * Loops are printed on an explicit stack, since they can nest too deeply to
+ * recurse into.
+ */
+void print_bf_op(bf_op *op, int indent) {
+	if (op->op_type != BF_OP_LOOP && op->op_type != BF_OP_ONCE) {
+		print_leaf_op(op);
+		return;
+	}
+
+	print_frame fixed[PRINT_STACK_FIXED];
+	print_frame *stack = fixed;
+	size_t depth = 0, alloc = PRINT_STACK_FIXED;
+	stack[depth++] = open_print_frame(op, indent);
+
+	while (depth) {
+		print_frame *frame = &stack[depth - 1];
+		if (frame->next_child == frame->op->children.len) {
+			close_print_frame(frame);
+			depth--;
+			continue;
+		}
+
+		bf_op *child = &frame->op->children.ops[frame->next_child++];
+		if (child->op_type == BF_OP_LOOP || child->op_type == BF_OP_ONCE) {
+			int child_indent = frame->indent;
+			if (depth == alloc)
+				stack = grow_stack(stack, fixed, &alloc, sizeof *stack);
+			stack[depth++] = open_print_frame(child, child_indent);
+		} else {
+			print_leaf_op(child);
+		}
+	}
+
+	if (stack != fixed)
+		free(stack);
+}
+
+char const *flattened_op_name(char op) {
+	static char const *const names[BF_OP_COUNT] = {
+		[BF_OP_ALTER] = "ALTER",
+		[BF_OP_IN] = "IN",
+		[BF_OP_OUT] = "OUT",
+		[BF_OP_BOUNDS_CHECK] = "BOUNDS_CHECK",
+		[BF_OP_SET] = "SET",
+		[BF_OP_SET_MULTI] = "SET_MULTI",
+		[BF_OP_MULTIPLY] = "MULTIPLY",
+		[BF_OP_SKIP] = "SKIP",
+		[BF_OP_ALTER_MOVEONLY] = "ALTER_MOVEONLY",
+		[BF_OP_ALTER_ADDONLY] = "ALTER_ADDONLY",
+		[BF_OP_JUMPIFNONZERO] = "JUMPIFNONZERO",
+		[BF_OP_JUMPIFZERO] = "JUMPIFZERO",
+		[BF_OP_DIE] = "DIE",
+		[BF_OP_NATIVE_LOOP] = "NATIVE_LOOP",
+		[BF_OP_MOVE_MULTIPLY] = "MOVE_MULTIPLY",
+		[BF_OP_MOVE_JUMPIFNONZERO] = "MOVE_JUMPIFNONZERO",
+		[BF_OP_MOVE_NATIVE_LOOP] = "MOVE_NATIVE_LOOP",
+		[BF_OP_DIVIDE] = "DIVIDE",
+		[BF_OP_PRODUCT] = "PRODUCT",
+		[BF_OP_ADD_AT] = "ADD_AT",
+		[BF_OP_WRITE_CONST] = "WRITE_CONST",
+		[BF_OP_CLEAR_RUN] = "CLEAR_RUN",
+		[BF_OP_SHIFT_RUN] = "SHIFT_RUN",
+		[BF_OP_SET_AT] = "SET_AT",
+		[BF_OP_IN_AT] = "IN_AT",
+		[BF_OP_OUT_AT] = "OUT_AT",
+	};
+	enum bf_op_type type = BYTECODE_OP(op);
+	return type < BF_OP_COUNT && names[type] ? names[type] : "INVALID";
+}
+
+static ssize_t take_offset(char *restrict opcodes, size_t *address, char opcode) {
+	char *operand = &opcodes[*address];
+	ssize_t offset = read_offset_operand(&operand, opcode);
+	*address = operand - opcodes;
+	return offset;
+}
+
+static ssize_t take_jump(char *restrict opcodes, size_t *address) {
+	char *operand = &opcodes[*address];
+	ssize_t offset = read_jump_operand(&operand);
+	*address = operand - opcodes;
+	return offset;
+}
+
+// Shows how wide the offset operands of an op are stored
+static int offset_bits(char opcode) {
+	return (int)offset_operand_size(opcode) * 8;
+}
+
+/*
+ * Prints a part of the source as line:column, line:column-column or
+ * line:column-line:column.
+ */
+void print_source_range(FILE *to, source_range range) {
+	if (!range.first_line)
+		fprintf(to, "-");
+	else if (range.first_line == range.last_line && range.first_column == range.last_column)
+		fprintf(to, "%" PRIu32 ":%" PRIu32, range.first_line, range.first_column);
+	else if (range.first_line == range.last_line)
+		fprintf(to, "%" PRIu32 ":%" PRIu32 "-%" PRIu32, range.first_line, range.first_column, range.last_column);
+	else
+		fprintf(to, "%" PRIu32 ":%" PRIu32 "-%" PRIu32 ":%" PRIu32, range.first_line, range.first_column, range.last_line, range.last_column);
+}
+
+void print_flattened(char *restrict opcodes, source_map const *map) {
 	size_t address = 0;
+	size_t next_entry = 0;
 	while (true) {
 		size_t start_address = address;
-		switch (opcodes[address++]) {
+		// Each op which starts a new part of the source gets a comment saying which
+		if (next_entry < map->len && map->entries[next_entry].address == start_address) {
+			source_range source = map->entries[next_entry++].source;
+			if (source.first_line) {
+				printf("          ; ");
+				print_source_range(stdout, source);
+				putchar('\n');
+			}
+		}
+		char opcode = opcodes[address++];
+		switch (BYTECODE_OP(opcode)) {
 			case BF_OP_ALTER: {
-				ssize_t offset = *(ssize_t*)&opcodes[address];
-				address += sizeof(ssize_t);
+				ssize_t offset = take_offset(opcodes, &address, opcode);
 				cell_int amount = *(cell_int*)&opcodes[address];
 				address += sizeof(cell_int);
 
-				printf("%08zx: ALTER >%zd %+d\n", start_address, offset, (int)amount);
+				printf("%08zx: ALTER/%d >%zd %+d\n", start_address, offset_bits(opcode), offset, (int)amount);
 				break;
 			}
 
 #ifndef FIXED_TAPE_SIZE
 			case BF_OP_BOUNDS_CHECK: {
-				ssize_t offset = *(ssize_t*)&opcodes[address];
-				address += sizeof(ssize_t);
+				ssize_t offset = take_offset(opcodes, &address, opcode);
 
-				printf("%08zx: BOUNDS_CHECK %zd\n", start_address, offset);
+				printf("%08zx: BOUNDS_CHECK/%d %zd\n", start_address, offset_bits(opcode), offset);
 				break;
 			}
 #endif
 
 			case BF_OP_ALTER_MOVEONLY: {
-				ssize_t offset = *(ssize_t*)&opcodes[address];
-				address += sizeof(ssize_t);
+				ssize_t offset = take_offset(opcodes, &address, opcode);
+
+				printf("%08zx: ALTER_MOVEONLY/%d >%zd\n", start_address, offset_bits(opcode), offset);
+				break;
+			}
+
+			case BF_OP_ADD_AT: {
+				ssize_t offset = take_offset(opcodes, &address, opcode);
+				cell_int amount = *(cell_int*)&opcodes[address];
+				address += sizeof(cell_int);
+
+				printf("%08zx: ADD_AT/%d @%zd %+d\n", start_address, offset_bits(opcode), offset, (int)amount);
+				break;
+			}
 
-				printf("%08zx: ALTER_MOVEONLY >%zd\n", start_address, offset);
+			case BF_OP_SET_AT: {
+				ssize_t offset = take_offset(opcodes, &address, opcode);
+				cell_int amount = *(cell_int*)&opcodes[address];
+				address += sizeof(cell_int);
+
+				printf("%08zx: SET_AT/%d @%zd %d\n", start_address, offset_bits(opcode), offset, (int)amount);
 				break;
 			}
 
@@ -113,14 +312,17 @@ void print_flattened(char *restrict opcodes) {
 				break;
 			}
 
+			case BF_OP_MOVE_MULTIPLY:
+				printf("%08zx: MOVE_MULTIPLY/%d >%zd\n", start_address, offset_bits(opcode), take_offset(opcodes, &address, opcode));
+				// Fallthrough
+
 			case BF_OP_MULTIPLY: {
 				uint8_t repeat = *(uint8_t*)&opcodes[address];
 				address++;
-				printf("%08zx: MULTIPLY {\n", start_address);
+				printf("%08zx: MULTIPLY/%d {\n", start_address, offset_bits(opcode));
 				do {
 					size_t this_address = address;
-					ssize_t offset = *(ssize_t*)&opcodes[address];
-					address += sizeof(ssize_t);
+					ssize_t offset = take_offset(opcodes, &address, opcode);
 					cell_int amount = *(cell_int*)&opcodes[address];
 					address += sizeof(cell_int);
 
@@ -140,12 +342,31 @@ void print_flattened(char *restrict opcodes) {
 			}
 
 			case BF_OP_SET_MULTI: {
-				ssize_t offset = *(ssize_t*)&opcodes[address];
-				address += sizeof(ssize_t);
+				ssize_t offset = take_offset(opcodes, &address, opcode);
+				cell_int amount = *(cell_int*)&opcodes[address];
+				address += sizeof(cell_int);
+
+				printf("%08zx: SET_MULTI/%d %d,+%zd\n", start_address, offset_bits(opcode), (int)amount, offset);
+				break;
+			}
+
+			case BF_OP_PRODUCT: {
+				ssize_t offset = take_offset(opcodes, &address, opcode);
+				ssize_t factor = take_offset(opcodes, &address, opcode);
 				cell_int amount = *(cell_int*)&opcodes[address];
 				address += sizeof(cell_int);
 
-				printf("%08zx: SET_MULTI %d,+%zd\n", start_address, (int)amount, offset);
+				printf("%08zx: PRODUCT/%d @%zd *@%zd *%d\n", start_address, offset_bits(opcode), offset, factor, (int)amount);
+				break;
+			}
+
+			case BF_OP_DIVIDE: {
+				cell_int multiplier = *(cell_int*)&opcodes[address];
+				address += sizeof(cell_int);
+				uint8_t shift = *(uint8_t*)&opcodes[address];
+				address++;
+
+				printf("%08zx: DIVIDE *%d >>%d\n", start_address, (int)multiplier, (int)shift);
 				break;
 			}
 
@@ -157,29 +378,66 @@ void print_flattened(char *restrict opcodes) {
 				printf("%08zx: OUT\n", start_address);
 				break;
 
+			case BF_OP_IN_AT:
+				printf("%08zx: IN_AT/%d @%zd\n", start_address, offset_bits(opcode), take_offset(opcodes, &address, opcode));
+				break;
+
+			case BF_OP_OUT_AT:
+				printf("%08zx: OUT_AT/%d @%zd\n", start_address, offset_bits(opcode), take_offset(opcodes, &address, opcode));
+				break;
+
+			case BF_OP_WRITE_CONST: {
+				size_t length = take_offset(opcodes, &address, opcode);
+
+				printf("%08zx: WRITE_CONST/%d ", start_address, offset_bits(opcode));
+				print_text(&opcodes[address], length);
+				putchar('\n');
+				address += length;
+				break;
+			}
+
 
 			case BF_OP_SKIP: {
-				ssize_t offset = *(ssize_t*)&opcodes[address];
-				address += sizeof(ssize_t);
+				ssize_t offset = take_offset(opcodes, &address, opcode);
 
-				printf("%08zx: SKIP >%zd\n", start_address, offset);
+				printf("%08zx: SKIP/%d >%zd\n", start_address, offset_bits(opcode), offset);
+				break;
+			}
+
+			case BF_OP_CLEAR_RUN: {
+				ssize_t offset = take_offset(opcodes, &address, opcode);
+
+				printf("%08zx: CLEAR_RUN/%d >%zd\n", start_address, offset_bits(opcode), offset);
+				break;
+			}
+
+			case BF_OP_SHIFT_RUN: {
+				ssize_t offset = take_offset(opcodes, &address, opcode);
+				ssize_t distance = take_offset(opcodes, &address, opcode);
+
+				printf("%08zx: SHIFT_RUN/%d >%zd @%zd\n", start_address, offset_bits(opcode), offset, distance);
 				break;
 			}
 
 			case BF_OP_JUMPIFZERO: {
-				ssize_t offset = *(ssize_t*)&opcodes[address];
-				address += sizeof(ssize_t);
+				ssize_t offset = take_jump(opcodes, &address);
 				printf("%08zx: JUMPIFZERO %+zd (%zx)\n", start_address, offset, address + offset);
 				break;
 			}
 
 			case BF_OP_JUMPIFNONZERO: {
-				ssize_t offset = *(ssize_t*)&opcodes[address];
-				address += sizeof(ssize_t);
+				ssize_t offset = take_jump(opcodes, &address);
 				printf("%08zx: JUMPIFNONZERO %+zd (%zx)\n", start_address, offset, address + offset);
 				break;
 			}
 
+			case BF_OP_MOVE_JUMPIFNONZERO: {
+				ssize_t move = take_offset(opcodes, &address, opcode);
+				ssize_t offset = take_jump(opcodes, &address);
+				printf("%08zx: MOVE_JUMPIFNONZERO/%d >%zd %+zd (%zx)\n", start_address, offset_bits(opcode), move, offset, address + offset);
+				break;
+			}
+
 			case BF_OP_DIE:
 				printf("%08zx: DIE\n", start_address);
 				return;
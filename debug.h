@@ -1,9 +1,14 @@
 #ifndef USING_DEBUG_H
 #define USING_DEBUG_H
 
+#include <stdio.h>
+
 #include "brainfuck.h"
+#include "flattener.h"
 
 void print_bf_op(bf_op *op, int indent);
-void print_flattened(char *opcodes);
+void print_source_range(FILE *to, source_range range);
+void print_flattened(char *opcodes, source_map const *map);
+char const *flattened_op_name(char op);
 
 #endif
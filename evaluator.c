@@ -0,0 +1,343 @@
+#include <assert.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "evaluator.h"
+#include "optimizer_helpers.h"
+#include "flattener.h"
+#include "tape.h"
+
+// How deep loops can nest before the evaluator's stack moves to the heap
+#define EVAL_STACK_FIXED 32
+
+// How much of the tape a program can use while it's being evaluated
+#define EVAL_TAPE_CELLS 65536
+
+#ifdef FIXED_TAPE_SIZE
+// The position wraps around like the real one, starting where tape_init starts it
+typedef FIXED_TAPE_SIZE eval_pos;
+#define EVAL_ORIGIN 16
+#define EVAL_CELLS FIXED_TAPE_CELLS
+#else
+typedef ssize_t eval_pos;
+#define EVAL_ORIGIN (EVAL_TAPE_CELLS / 2)
+#define EVAL_CELLS EVAL_TAPE_CELLS
+#endif
+
+typedef struct {
+	cell_int *cells;  // EVAL_CELLS of them, with the program starting at EVAL_ORIGIN
+	eval_pos pos;
+	char *output;
+	size_t output_len, output_alloc;
+	size_t steps;  // How many more ops and loop tests can be run
+} eval_state;
+
+typedef struct {
+	bf_op *loop;
+	size_t next_child;
+} eval_frame;
+
+// The cell at an offset from the position, or NULL if it's off the part of the tape being evaluated
+static cell_int *eval_cell(eval_state *state, ssize_t offset) {
+#ifdef FIXED_TAPE_SIZE
+	// Offsets wrap around with the position, so the whole tape is always in reach
+	return &state->cells[TAPE_INDEX(state->pos, offset)];
+#else
+	ssize_t index = (ssize_t)state->pos + offset;
+	if (index < 0 || index >= (ssize_t)EVAL_CELLS)
+		return NULL;
+	return &state->cells[index];
+#endif
+}
+
+// Adds cells together, wrapping round as a cell would
+static cell_int add_cells(cell_int a, cell_int b) {
+	return (cell_int)((uint64_t)a + (uint64_t)b);
+}
+
+static void eval_output(eval_state *state, char const *text, size_t length) {
+	if (state->output_len + length > state->output_alloc) {
+		size_t alloc = state->output_alloc ? state->output_alloc : 256;
+		while (state->output_len + length > alloc)
+			alloc *= 2;
+		state->output = realloc(state->output, alloc);
+		state->output_alloc = alloc;
+	}
+	memcpy(state->output + state->output_len, text, length);
+	state->output_len += length;
+}
+
+/*
+ * Runs any op but a LOOP, returning false if it can't be run while compiling
+ * (which may leave it half done).
+ */
+static bool eval_leaf(eval_state *state, bf_op *op) {
+	cell_int *cell;
+	switch (op->op_type) {
+		case BF_OP_ALTER:
+			state->pos += op->offset;
+			if (op->amount) {
+				if (!(cell = eval_cell(state, 0)))
+					return false;
+				*cell = add_cells(*cell, op->amount);
+			}
+			return true;
+
+		case BF_OP_ADD_AT:
+			if (!(cell = eval_cell(state, op->offset)))
+				return false;
+			*cell = add_cells(*cell, op->amount);
+			return true;
+
+		case BF_OP_SET_AT:
+			if (!(cell = eval_cell(state, op->offset)))
+				return false;
+			*cell = op->amount;
+			return true;
+
+		case BF_OP_SET:
+			if (!eval_cell(state, 0) || !eval_cell(state, op->offset) || state->steps <= (size_t)op->offset)
+				return false;
+			state->steps -= op->offset;
+			// One at a time, as they might wrap around a fixed tape
+			for (ssize_t i = 0; i <= op->offset; i++)
+				*eval_cell(state, i) = op->amount;
+			return true;
+
+		case BF_OP_MULTIPLY: {
+			cell_int *target = eval_cell(state, op->offset);
+			if (!(cell = eval_cell(state, 0)) || !target)
+				return false;
+			*target = add_cells(*target, multiply_cells(*cell, op->amount, 1));
+			return true;
+		}
+
+		case BF_OP_PRODUCT: {
+			cell_int *target = eval_cell(state, op->offset), *factor = eval_cell(state, op->factor);
+			if (!(cell = eval_cell(state, 0)) || !target || !factor)
+				return false;
+			*target = add_cells(*target, multiply_cells(*cell, *factor, op->amount));
+			return true;
+		}
+
+		case BF_OP_DIVIDE: {
+			if (!(cell = eval_cell(state, 0)))
+				return false;
+			// Split up as the flattener does it
+			cell_int step = op->amount;
+			unsigned shift = 0;
+			for (; !(step & 1); shift++)
+				step = (cell_int)((uint64_t)step >> 1);
+			// A loop which would never stop is left to hang for real
+			return divide_cell(cell, -cell_inverse(step), shift);
+		}
+
+		case BF_OP_SKIP:
+			while (true) {
+				if (!(cell = eval_cell(state, 0)) || !state->steps)
+					return false;
+				state->steps--;
+				if (!*cell)
+					return true;
+				state->pos += op->offset;
+			}
+
+		case BF_OP_CLEAR_RUN:
+		case BF_OP_SHIFT_RUN:
+			while (true) {
+				if (!(cell = eval_cell(state, 0)) || !state->steps)
+					return false;
+				state->steps--;
+				if (!*cell)
+					return true;
+				if (op->op_type == BF_OP_SHIFT_RUN) {
+					cell_int *target = eval_cell(state, op->factor);
+					if (!target)
+						return false;
+					*target = add_cells(*target, *cell);
+				}
+				*cell = 0;
+				state->pos += op->offset;
+			}
+
+		case BF_OP_OUT:
+		case BF_OP_OUT_AT: {
+			if (!(cell = eval_cell(state, op->op_type == BF_OP_OUT_AT ? op->offset : 0)))
+				return false;
+			char c = *cell;
+			eval_output(state, &c, 1);
+			return true;
+		}
+
+		case BF_OP_WRITE_CONST:
+			eval_output(state, op->text, op->text_length);
+			return true;
+
+		case BF_OP_BOUNDS_CHECK:
+			return true;
+
+		case BF_OP_IN:
+		case BF_OP_IN_AT:
+			return false;
+
+		default:
+			assert(!"Unexpected opcode");
+			return false;
+	}
+}
+
+/*
+ * Runs one of the program's top-level ops, and everything in it if it's a
+ * loop.  Returns false if it couldn't be run to the end.  Loops are run on an
+ * explicit stack, as they can nest very deeply.
+ */
+static bool eval_op(eval_state *state, bf_op *op) {
+	if (!state->steps)
+		return false;
+	state->steps--;
+	if (op->op_type != BF_OP_LOOP)
+		return eval_leaf(state, op);
+
+	cell_int *cell = eval_cell(state, 0);
+	if (!cell)
+		return false;
+	if (!*cell)
+		return true;
+
+	eval_frame fixed[EVAL_STACK_FIXED];
+	eval_frame *stack = fixed;
+	size_t depth = 0, alloc = EVAL_STACK_FIXED;
+	stack[depth++] = (eval_frame) {.loop = op};
+
+	bool ok = true;
+	while (depth && ok) {
+		if (!state->steps) {
+			ok = false;
+			break;
+		}
+		state->steps--;
+
+		eval_frame *frame = &stack[depth - 1];
+		bf_op_builder *children = &frame->loop->children;
+		if (frame->next_child == children->len) {
+			// The test at the end of every pass through the loop
+			if (!(cell = eval_cell(state, 0)))
+				ok = false;
+			else if (*cell)
+				frame->next_child = 0;
+			else
+				depth--;
+			continue;
+		}
+
+		bf_op *child = &children->ops[frame->next_child++];
+		if (child->op_type != BF_OP_LOOP) {
+			ok = eval_leaf(state, child);
+		} else if (!(cell = eval_cell(state, 0))) {
+			ok = false;
+		} else if (*cell) {
+			if (depth == alloc)
+				stack = grow_stack(stack, fixed, &alloc, sizeof *stack);
+			stack[depth++] = (eval_frame) {.loop = child};
+		}
+	}
+
+	if (stack != fixed)
+		free(stack);
+	return ok;
+}
+
+/*
+ * Runs the program's top-level ops while compiling it, until one needs input,
+ * goes off the part of the tape being evaluated, or runs out of steps.  The
+ * ones which ran are replaced with their output, written all at once, then
+ * what they left on the tape.  A top-level op is either replaced as a whole or
+ * not at all, so the program carries on from the first one which couldn't be
+ * run to the end.  Returns whether any were replaced.
+ */
+bool evaluate_prefix(bf_op_builder *ops, size_t steps) {
+	if (!steps || !ops->len)
+		return false;
+
+	eval_state state = {
+		.cells = calloc(EVAL_CELLS, sizeof(cell_int)),
+		.pos = EVAL_ORIGIN,
+		.steps = steps,
+	};
+	size_t done = 0;
+	while (done < ops->len && eval_op(&state, &ops->ops[done]))
+		done++;
+
+	if (done < ops->len) {
+		// The op which stopped it may be half done, so go again up to it
+		memset(state.cells, 0, EVAL_CELLS * sizeof *state.cells);
+		state.pos = EVAL_ORIGIN;
+		state.output_len = 0;
+		state.steps = SIZE_MAX;
+		for (size_t i = 0; i < done; i++)
+			eval_op(&state, &ops->ops[i]);
+	}
+
+	// Adds and sets are as cheap to run as the tape they'd be replaced with
+	bool worth_it = done == ops->len;
+	for (size_t i = 0; i < done && !worth_it; i++)
+		worth_it = ops->ops[i].op_type != BF_OP_ALTER && ops->ops[i].op_type != BF_OP_SET;
+
+	if (done && worth_it) {
+		source_range source = {0};
+		for (size_t i = 0; i < done; i++)
+			source = source_range_union(source, ops->ops[i].source);
+
+		// Nothing will look at the tape if nothing is left to run
+		bool rest = done < ops->len;
+		ssize_t move = (ssize_t)state.pos - EVAL_ORIGIN;
+		size_t count = state.output_len != 0;
+		if (rest) {
+			for (size_t i = 0; i < EVAL_CELLS; i++)
+				count += state.cells[i] != 0;
+			count += move != 0;
+		}
+
+		char *text = NULL;
+		if (state.output_len) {
+			text = bf_arena_alloc(ops->arena, state.output_len);
+			memcpy(text, state.output, state.output_len);
+		}
+
+		remove_bf_ops(ops, 0, done);
+		bf_op *op = insert_bf_ops(ops, 0, count);
+		if (state.output_len) {
+			*op++ = (bf_op) {
+				.op_type = BF_OP_WRITE_CONST,
+				.text = text,
+				.text_length = state.output_len,
+				.source = source,
+			};
+		}
+		if (rest) {
+			// The tape starts off all zeros, so adding is setting
+			for (size_t i = 0; i < EVAL_CELLS; i++) {
+				if (!state.cells[i])
+					continue;
+				*op++ = (bf_op) {
+					.op_type = BF_OP_ADD_AT,
+					.offset = (ssize_t)i - EVAL_ORIGIN,
+					.amount = state.cells[i],
+					.source = source,
+				};
+			}
+			if (move) {
+				*op++ = (bf_op) {
+					.op_type = BF_OP_ALTER,
+					.offset = move,
+					.source = source,
+				};
+			}
+		}
+	}
+
+	free(state.cells);
+	free(state.output);
+	return done && worth_it;
+}
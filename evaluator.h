@@ -0,0 +1,14 @@
+#ifndef USING_EVALUATOR_H
+#define USING_EVALUATOR_H
+
+/*
+ * Running the start of a program while compiling it, so that whatever it
+ * does before it first needs input is done once and for all.
+ */
+#include <stddef.h>
+
+#include "brainfuck.h"
+
+bool evaluate_prefix(bf_op_builder *ops, size_t steps);
+
+#endif
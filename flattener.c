@@ -1,97 +1,231 @@
 #include <assert.h>
 #include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <err.h>
 
 #include "optimizer_helpers.h"
 #include "flattener.h"
 
+// How deep loops can nest before the flattener's stack moves to the heap
+#define FLATTEN_STACK_FIXED 32
+
 static void blob_ensure_extra(blob_cursor *out, size_t extra) {
 	if (out->len < out->pos + extra) {
-		out->len *= 2;
+		while (out->len < out->pos + extra)
+			out->len *= 2;
 		out->data = realloc(out->data, out->len);
 	}
 }
 
 typedef struct {
 	interpreter_meta interp_meta;
+	source_map *map;
 	ssize_t previous_op;
+	enum operand_width multiply_width;  // Wide enough for every term of the multiply being flattened
 } flattener_state;
 
-static void flatten_bf_internal(bf_op *op, blob_cursor *out, flattener_state *state) {
+/*
+ * Records that the op at the given address came from the given source.  Ops
+ * are flattened in order, so if there's already an entry at (or after) the
+ * address, the op has been fused into the last one and its source is added to
+ * that instead.
+ */
+static void map_source(source_map *map, size_t address, source_range source) {
+	if (map->len && map->entries[map->len - 1].address >= address) {
+		source_map_entry *last = &map->entries[map->len - 1];
+		last->source = source_range_union(last->source, source);
+		return;
+	}
+
+	if (map->len == map->alloc) {
+		map->alloc = map->alloc ? map->alloc * 2 : 64;
+		map->entries = realloc(map->entries, map->alloc * sizeof *map->entries);
+	}
+	map->entries[map->len++] = (source_map_entry) {
+		.address = address,
+		.source = source,
+	};
+}
+
+// The position of the first or last character of a range
+static source_range source_start(source_range range) {
+	range.last_line = range.first_line;
+	range.last_column = range.first_column;
+	return range;
+}
+
+static source_range source_end(source_range range) {
+	range.first_line = range.last_line;
+	range.first_column = range.last_column;
+	return range;
+}
+
+static enum operand_width offset_width(ssize_t offset) {
+	if (offset >= INT8_MIN && offset <= INT8_MAX)
+		return OPERAND_8;
+	if (offset >= INT16_MIN && offset <= INT16_MAX)
+		return OPERAND_16;
+	if (offset >= INT32_MIN && offset <= INT32_MAX)
+		return OPERAND_32;
+	return OPERAND_WORD;
+}
+
+static void emit_offset(blob_cursor *out, ssize_t offset, enum operand_width width) {
+	switch (width) {
+		case OPERAND_8: *(int8_t*)&out->data[out->pos] = offset; break;
+		case OPERAND_16: *(int16_t*)&out->data[out->pos] = offset; break;
+		case OPERAND_32: *(int32_t*)&out->data[out->pos] = offset; break;
+		case OPERAND_WORD: *(ssize_t*)&out->data[out->pos] = offset; break;
+	}
+	out->pos += offset_operand_size(width);
+}
+
+/*
+ * Emits the narrowest variant of an op with a single offset operand, leaving
+ * room for anything which comes after the offset.
+ */
+static void emit_offset_op(blob_cursor *out, enum bf_op_type type, ssize_t offset, size_t extra) {
+	enum operand_width width = offset_width(offset);
+	blob_ensure_extra(out, 1 + offset_operand_size(width) + extra);
+	out->data[out->pos++] = type | width;
+	emit_offset(out, offset, width);
+}
+
+static void emit_jump_placeholder(blob_cursor *out) {
+	out->pos += sizeof(jump_offset);
+}
+
+static void patch_jump(blob_cursor *out, size_t at, ssize_t distance) {
+	if (distance < INT32_MIN || distance > INT32_MAX)
+		errx(1, "Loop too long to flatten");
+	*(jump_offset*)&out->data[at] = distance;
+}
+
+/*
+ * Gets the position of the term count of the MULTIPLY or MOVE_MULTIPLY
+ * starting at the given position, or -1 if there isn't one there.
+ */
+static ssize_t multiply_count_at(blob_cursor *out, ssize_t op) {
+	if (op == -1)
+		return -1;
+	if (BYTECODE_OP(out->data[op]) == BF_OP_MULTIPLY)
+		return op + 1;
+	if (BYTECODE_OP(out->data[op]) == BF_OP_MOVE_MULTIPLY)
+		return op + 1 + offset_operand_size(out->data[op]);
+	return -1;
+}
+
+/*
+ * Checks whether the op starting at the given position is a lone pointer
+ * move, which the op about to be emitted could be fused with.
+ */
+static bool is_fusable_move(blob_cursor *out, ssize_t op) {
+	return op != -1 && BYTECODE_OP(out->data[op]) == BF_OP_ALTER_MOVEONLY
+		&& (size_t)op + 1 + offset_operand_size(out->data[op]) == out->pos;
+}
+
+typedef struct {
+	bf_op *op;  // A LOOP or the ONCE
+	size_t next_child;
+	size_t loop_start, loop_body_start;
+	bool have_initial_jump;
+} flatten_frame;
+
+// Starts the loop or program, which its children are flattened into next
+static flatten_frame open_container(bf_op *op, blob_cursor *out, flattener_state *state) {
+	flatten_frame frame = {.op = op};
+	if (op->op_type == BF_OP_LOOP) {
+		frame.loop_start = out->pos;
+		frame.have_initial_jump = !op->definitely_nonzero;
+		if (frame.have_initial_jump) {
+			// The jumps belong to the brackets
+			map_source(state->map, out->pos, source_start(op->source));
+			blob_ensure_extra(out, sizeof(jump_offset) + 1);
+			out->data[out->pos++] = BF_OP_JUMPIFZERO;
+			emit_jump_placeholder(out);
+		}
+		frame.loop_body_start = out->pos;
+	}
+	state->previous_op = -1;
+	return frame;
+}
+
+// Finishes the loop or program once all of its children are flattened
+static void close_container(flatten_frame const *frame, blob_cursor *out, flattener_state *state) {
+	bf_op *op = frame->op;
+	if (op->op_type == BF_OP_ONCE) {
+		map_source(state->map, out->pos, op->source);
+		blob_ensure_extra(out, 1);
+		out->data[out->pos++] = BF_OP_DIE;
+		state->previous_op = -1;
+		return;
+	}
+
+	bool have_final_jump = !get_loop_info(op).loops_once_at_most;
+	if (have_final_jump) {
+		blob_ensure_extra(out, sizeof(jump_offset) + 1);
+		if (is_fusable_move(out, state->previous_op)) {
+			// The jump offset goes after the move, which stays where it is
+			char *move = &out->data[state->previous_op];
+			*move = BF_OP_MOVE_JUMPIFNONZERO | (*move & OPERAND_WIDTH_MASK);
+			map_source(state->map, state->previous_op, source_end(op->source));
+		} else {
+			map_source(state->map, out->pos, source_end(op->source));
+			out->data[out->pos++] = BF_OP_JUMPIFNONZERO;
+		}
+		emit_jump_placeholder(out);
+	}
+
+	// Difference between end of first jump instruction and here
+	ssize_t jump_distance = out->pos - frame->loop_body_start;
+	if (frame->have_initial_jump)
+		patch_jump(out, frame->loop_start + 1, jump_distance);
+
+	if (have_final_jump) {
+		// On the nonzero jump, skip all jump-if-zeros because they will never fire
+		while (out->data[out->pos - jump_distance] == BF_OP_JUMPIFZERO) {
+			jump_distance -= sizeof(jump_offset) + 1;
+		}
+		patch_jump(out, out->pos - sizeof(jump_offset), -jump_distance);
+	}
+	// Can't merge with loops (or "if"s)
+	state->previous_op = -1;
+}
+
+// Leaves room past the ends of the tape for anything which scans like a skip to step onto
+static void pad_for_skip(interpreter_meta *meta, ssize_t stride) {
+	if (stride < meta->lowest_negative_skip) {
+		meta->lowest_negative_skip = stride;
+	} else if (stride > meta->highest_positive_skip) {
+		meta->highest_positive_skip = stride;
+	}
+}
+
+// Flattens any op but a LOOP or the ONCE
+static void flatten_op(bf_op *op, blob_cursor *out, flattener_state *state) {
 	ssize_t op_start = (ssize_t)out->pos;
 	switch (op->op_type) {
 		case BF_OP_ALTER:
+			map_source(state->map, out->pos, op->source);
 			if (op->offset && op->amount) {
-				blob_ensure_extra(out, sizeof(ssize_t) + sizeof(cell_int) + 1);
-				out->data[out->pos++] = BF_OP_ALTER;
+				emit_offset_op(out, BF_OP_ALTER, op->offset, sizeof(cell_int));
 			} else if (op->offset) {
-				blob_ensure_extra(out, sizeof(ssize_t) + 1);
-				out->data[out->pos++] = BF_OP_ALTER_MOVEONLY;
+				emit_offset_op(out, BF_OP_ALTER_MOVEONLY, op->offset, 0);
 			} else {
 				assert(op->amount);
 				blob_ensure_extra(out, sizeof(cell_int) + 1);
 				out->data[out->pos++] = BF_OP_ALTER_ADDONLY;
 			}
 
-			if (op->offset) {
-				*(ssize_t*)&out->data[out->pos] = op->offset;
-				out->pos += sizeof(ssize_t);
-			}
 			if (op->amount) {
 				*(cell_int*)&out->data[out->pos] = op->amount;
 				out->pos += sizeof(cell_int);
 			}
 			break;
 
-		case BF_OP_LOOP: {
-			size_t loop_start = out->pos;
-			bool have_initial_jump = !op->definitely_nonzero;
-			if (have_initial_jump) {
-				blob_ensure_extra(out, sizeof(ssize_t) + 1);
-				out->data[out->pos++] = BF_OP_JUMPIFZERO;
-				out->pos += sizeof(ssize_t);
-			}
-			size_t loop_body_start = out->pos;
-
-			state->previous_op = -1;
-			for (size_t i = 0; i < op->children.len; i++)
-				flatten_bf_internal(&op->children.ops[i], out, state);
-
-			bool have_final_jump = !get_loop_info(op).loops_once_at_most;
-			if (have_final_jump) {
-				blob_ensure_extra(out, sizeof(ssize_t) + 1);
-				out->data[out->pos++] = BF_OP_JUMPIFNONZERO;
-				out->pos += sizeof(ssize_t);
-			}
-
-			// Difference between end of first jump instruction and here
-			ssize_t jump_distance = out->pos - loop_body_start;
-			if (have_initial_jump)
-				*(ssize_t*)&out->data[loop_start + 1] = jump_distance;
-
-			if (have_final_jump) {
-				// On the nonzero jump, skip all jump-if-zeros because they will never fire
-				while (out->data[out->pos - jump_distance] == BF_OP_JUMPIFZERO) {
-					jump_distance -= sizeof(ssize_t) + 1;
-				}
-				*(ssize_t*)&out->data[out->pos - sizeof(ssize_t)] = -jump_distance;
-			}
-			// Can't merge with loops (or "if"s)
-			op_start = -1;
-			break;
-		}
-
-		case BF_OP_ONCE: {
-			state->previous_op = -1;
-			for (size_t i = 0; i < op->children.len; i++)
-				flatten_bf_internal(&op->children.ops[i], out, state);
-			op_start = -1;
-			blob_ensure_extra(out, 1);
-			out->data[out->pos++] = BF_OP_DIE;
-			break;
-		}
-
 		case BF_OP_SET: {
-			bool was_multiply = state->previous_op != -1 && out->data[state->previous_op] == BF_OP_MULTIPLY;
+			bool was_multiply = multiply_count_at(out, state->previous_op) != -1;
 			bool is_multi = op->offset != 0;
 			if (was_multiply) {
 				blob_ensure_extra(out, sizeof(cell_int));
@@ -106,64 +240,136 @@ static void flatten_bf_internal(bf_op *op, blob_cursor *out, flattener_state *st
 				}
 			}
 			if (is_multi) {
-				blob_ensure_extra(out, sizeof(ssize_t) + sizeof(cell_int) + 1);
-				out->data[out->pos++] = BF_OP_SET_MULTI;
-				*(ssize_t*)&out->data[out->pos] = op->offset;
-				out->pos += sizeof(ssize_t);
+				emit_offset_op(out, BF_OP_SET_MULTI, op->offset, sizeof(cell_int));
 			} else if (!was_multiply) {
 				blob_ensure_extra(out, sizeof(cell_int) + 1);
 				out->data[out->pos++] = BF_OP_SET;
 			}
 			*(cell_int*)&out->data[out->pos] = op->amount;
 			out->pos += sizeof(cell_int);
+			// The final SET of a multiply is part of it
+			map_source(state->map, op_start != -1 ? (size_t)op_start : (size_t)state->previous_op, op->source);
 			break;
 		}
 
-		case BF_OP_MULTIPLY:
-			if (state->previous_op != -1 && out->data[state->previous_op] == BF_OP_MULTIPLY
-					&& (uint8_t)out->data[state->previous_op + 1] != 0xFF) {
+		case BF_OP_MULTIPLY: {
+			ssize_t count = multiply_count_at(out, state->previous_op);
+			enum operand_width width;
+			if (count != -1 && (uint8_t)out->data[count] != 0xFF) {
+				width = out->data[state->previous_op] & OPERAND_WIDTH_MASK;
 				blob_ensure_extra(out, sizeof(ssize_t) + sizeof(cell_int));
-				out->data[state->previous_op + 1]++;
-
-				*(ssize_t*)&out->data[out->pos] = op->offset;
-				out->pos += sizeof(ssize_t);
-				*(cell_int*)&out->data[out->pos] = op->amount;
-				out->pos += sizeof(cell_int);
+				out->data[count]++;
 				op_start = state->previous_op;
 			} else {
-				blob_ensure_extra(out, sizeof(ssize_t) + sizeof(cell_int) + 2);
-				out->data[out->pos++] = BF_OP_MULTIPLY;
-				out->data[out->pos++] = 0;
+				width = state->multiply_width;
+				blob_ensure_extra(out, 2 * sizeof(ssize_t) + sizeof(cell_int) + 2);
+				if (is_fusable_move(out, state->previous_op)) {
+					// Re-emit the move fused with the multiply, wide enough for both
+					char *operand = &out->data[state->previous_op + 1];
+					ssize_t move = read_offset_operand(&operand, out->data[state->previous_op]);
+					if (offset_width(move) > width)
+						width = offset_width(move);
 
-				*(ssize_t*)&out->data[out->pos] = op->offset;
-				out->pos += sizeof(ssize_t);
-				*(cell_int*)&out->data[out->pos] = op->amount;
-				out->pos += sizeof(cell_int);
+					out->pos = state->previous_op;
+					out->data[out->pos++] = BF_OP_MOVE_MULTIPLY | width;
+					emit_offset(out, move, width);
+					op_start = state->previous_op;
+				} else {
+					out->data[out->pos++] = BF_OP_MULTIPLY | width;
+				}
+				out->data[out->pos++] = 0;
 			}
+
+			emit_offset(out, op->offset, width);
+			*(cell_int*)&out->data[out->pos] = op->amount;
+			out->pos += sizeof(cell_int);
+			map_source(state->map, op_start, op->source);
 			break;
+		}
 
 		case BF_OP_BOUNDS_CHECK:
-			blob_ensure_extra(out, sizeof(ssize_t) + 1);
-			out->data[out->pos++] = op->op_type;
-			*(ssize_t*)&out->data[out->pos] = op->offset;
-			out->pos += sizeof(ssize_t);
+			map_source(state->map, out->pos, op->source);
+			emit_offset_op(out, BF_OP_BOUNDS_CHECK, op->offset, 0);
+			break;
+
+		case BF_OP_ADD_AT:
+		case BF_OP_SET_AT:
+			map_source(state->map, out->pos, op->source);
+			emit_offset_op(out, op->op_type, op->offset, sizeof(cell_int));
+			*(cell_int*)&out->data[out->pos] = op->amount;
+			out->pos += sizeof(cell_int);
 			break;
 
+		case BF_OP_IN_AT:
+		case BF_OP_OUT_AT:
+			map_source(state->map, out->pos, op->source);
+			emit_offset_op(out, op->op_type, op->offset, 0);
+			break;
+
+		case BF_OP_WRITE_CONST:
+			// The length is stored like an offset, followed by the text itself
+			map_source(state->map, out->pos, op->source);
+			emit_offset_op(out, BF_OP_WRITE_CONST, op->text_length, op->text_length);
+			memcpy(&out->data[out->pos], op->text, op->text_length);
+			out->pos += op->text_length;
+			break;
+
+		case BF_OP_PRODUCT: {
+			// Both offsets share one width
+			enum operand_width width = offset_width(op->offset);
+			if (offset_width(op->factor) > width)
+				width = offset_width(op->factor);
+
+			map_source(state->map, out->pos, op->source);
+			blob_ensure_extra(out, 1 + 2 * offset_operand_size(width) + sizeof(cell_int));
+			out->data[out->pos++] = BF_OP_PRODUCT | width;
+			emit_offset(out, op->offset, width);
+			emit_offset(out, op->factor, width);
+			*(cell_int*)&out->data[out->pos] = op->amount;
+			out->pos += sizeof(cell_int);
+			break;
+		}
+
+		case BF_OP_DIVIDE: {
+			// The step is split into an odd part and a power of two
+			cell_int step = op->amount;
+			uint8_t shift = 0;
+			for (; !(step & 1); shift++)
+				step = (cell_int)((uint64_t)step >> 1);
+
+			map_source(state->map, out->pos, op->source);
+			blob_ensure_extra(out, 2 + sizeof(cell_int));
+			out->data[out->pos++] = BF_OP_DIVIDE;
+			*(cell_int*)&out->data[out->pos] = -cell_inverse(step);
+			out->pos += sizeof(cell_int);
+			out->data[out->pos++] = shift;
+			break;
+		}
+
 		case BF_OP_SKIP:
-			blob_ensure_extra(out, sizeof(ssize_t) + 1);
-			out->data[out->pos++] = op->op_type;
-			*(ssize_t*)&out->data[out->pos] = op->offset;
-			out->pos += sizeof(ssize_t);
+		case BF_OP_CLEAR_RUN:
+			map_source(state->map, out->pos, op->source);
+			emit_offset_op(out, op->op_type, op->offset, 0);
+			pad_for_skip(&state->interp_meta, op->offset);
+			break;
 
-			if (op->offset < state->interp_meta.lowest_negative_skip) {
-				state->interp_meta.lowest_negative_skip = op->offset;
-			} else if (op->offset > state->interp_meta.highest_positive_skip) {
-				state->interp_meta.highest_positive_skip = op->offset;
-			}
+		case BF_OP_SHIFT_RUN: {
+			// The stride and the distance share one width
+			enum operand_width width = offset_width(op->offset);
+			if (offset_width(op->factor) > width)
+				width = offset_width(op->factor);
 
+			map_source(state->map, out->pos, op->source);
+			blob_ensure_extra(out, 1 + 2 * offset_operand_size(width));
+			out->data[out->pos++] = BF_OP_SHIFT_RUN | width;
+			emit_offset(out, op->offset, width);
+			emit_offset(out, op->factor, width);
+			pad_for_skip(&state->interp_meta, op->offset);
 			break;
+		}
 
 		default:
+			map_source(state->map, out->pos, op->source);
 			blob_ensure_extra(out, 1);
 			out->data[out->pos++] = op->op_type;
 			break;
@@ -171,8 +377,138 @@ static void flatten_bf_internal(bf_op *op, blob_cursor *out, flattener_state *st
 	state->previous_op = op_start;
 }
 
-interpreter_meta flatten_bf(bf_op *op, blob_cursor *out) {
-	flattener_state state = {.previous_op = -1};
-	flatten_bf_internal(op, out, &state);
+interpreter_meta flatten_bf(bf_op *op, blob_cursor *out, source_map *map) {
+	flattener_state state = {
+		.map = map,
+		.previous_op = -1,
+	};
+
+	// Loops are flattened on an explicit stack, as they can nest very deeply
+	flatten_frame fixed[FLATTEN_STACK_FIXED];
+	flatten_frame *stack = fixed;
+	size_t depth = 0, alloc = FLATTEN_STACK_FIXED;
+	stack[depth++] = open_container(op, out, &state);
+
+	while (depth) {
+		flatten_frame *frame = &stack[depth - 1];
+		bf_op_builder *children = &frame->op->children;
+		if (frame->next_child == children->len) {
+			close_container(frame, out, &state);
+			depth--;
+			continue;
+		}
+
+		size_t i = frame->next_child++;
+		bf_op *child = &children->ops[i];
+		if (child->op_type == BF_OP_MULTIPLY && (i == 0 || child[-1].op_type != BF_OP_MULTIPLY)) {
+			// All the terms of a multiply share one width, so find the widest now
+			state.multiply_width = OPERAND_8;
+			for (size_t j = i; j < children->len && children->ops[j].op_type == BF_OP_MULTIPLY; j++) {
+				enum operand_width width = offset_width(children->ops[j].offset);
+				if (width > state.multiply_width)
+					state.multiply_width = width;
+			}
+		}
+
+		if (child->op_type == BF_OP_LOOP) {
+			if (depth == alloc)
+				stack = grow_stack(stack, fixed, &alloc, sizeof *stack);
+			stack[depth++] = open_container(child, out, &state);
+		} else {
+			flatten_op(child, out, &state);
+		}
+	}
+
+	if (stack != fixed)
+		free(stack);
 	return state.interp_meta;
 }
+
+/*
+ * Gets the number of bytes taken up by the flattened op at the given
+ * position, including all of its operands.
+ */
+size_t bytecode_op_size(char *op) {
+	size_t offset_size = offset_operand_size(*op);
+	switch (BYTECODE_OP(*op)) {
+		case BF_OP_ALTER:
+		case BF_OP_SET_MULTI:
+		case BF_OP_ADD_AT:
+		case BF_OP_SET_AT:
+			return 1 + offset_size + sizeof(cell_int);
+		case BF_OP_BOUNDS_CHECK:
+		case BF_OP_ALTER_MOVEONLY:
+		case BF_OP_SKIP:
+		case BF_OP_CLEAR_RUN:
+		case BF_OP_IN_AT:
+		case BF_OP_OUT_AT:
+			return 1 + offset_size;
+		case BF_OP_SHIFT_RUN:
+			return 1 + 2 * offset_size;
+		case BF_OP_JUMPIFZERO:
+		case BF_OP_JUMPIFNONZERO:
+		case BF_OP_NATIVE_LOOP:
+			return 1 + sizeof(jump_offset);
+		case BF_OP_MOVE_JUMPIFNONZERO:
+		case BF_OP_MOVE_NATIVE_LOOP:
+			return 1 + offset_size + sizeof(jump_offset);
+		case BF_OP_ALTER_ADDONLY:
+		case BF_OP_SET:
+			return 1 + sizeof(cell_int);
+		case BF_OP_DIVIDE:
+			return 2 + sizeof(cell_int);
+		case BF_OP_PRODUCT:
+			return 1 + 2 * offset_size + sizeof(cell_int);
+		case BF_OP_WRITE_CONST: {
+			char *operand = op + 1;
+			return 1 + offset_size + read_offset_operand(&operand, *op);
+		}
+		case BF_OP_MULTIPLY: {
+			size_t terms = (size_t)*(uint8_t*)(op + 1) + 1;
+			// Header, the terms, then the amount of the SET it falls through into
+			return 2 + terms * (offset_size + sizeof(cell_int)) + sizeof(cell_int);
+		}
+		case BF_OP_MOVE_MULTIPLY: {
+			// As above, with the move between the opcode and the header
+			size_t terms = (size_t)*(uint8_t*)(op + 1 + offset_size) + 1;
+			return 2 + offset_size + terms * (offset_size + sizeof(cell_int)) + sizeof(cell_int);
+		}
+		case BF_OP_IN:
+		case BF_OP_OUT:
+		case BF_OP_DIE:
+			return 1;
+		default:
+			assert(!"Measuring an invalid opcode");
+			return 1;
+	}
+}
+
+/*
+ * Gets the length of a whole flattened program, up to and including its
+ * final DIE.
+ */
+size_t bytecode_length(char *bytecode) {
+	size_t length = 0;
+	while (true) {
+		char op = bytecode[length];
+		length += bytecode_op_size(&bytecode[length]);
+		if (op == BF_OP_DIE)
+			return length;
+	}
+}
+
+/*
+ * Gets the source of the op at the given address.
+ */
+source_range source_map_find(source_map const *map, size_t address) {
+	// Find the last entry at or before the address
+	size_t low = 0, high = map->len;
+	while (low < high) {
+		size_t middle = low + (high - low) / 2;
+		if (map->entries[middle].address <= address)
+			low = middle + 1;
+		else
+			high = middle;
+	}
+	return low ? map->entries[low - 1].source : (source_range) {0};
+}
@@ -1,6 +1,9 @@
 #ifndef USING_FLATTENER_H
 #define USING_FLATTENER_H
 
+#include <limits.h>
+#include <stdbool.h>
+#include <stdint.h>
 #include <stdlib.h>
 #include "brainfuck.h"
 #include "interpreter.h"
@@ -10,6 +13,96 @@ typedef struct {
 	size_t pos, len;
 } blob_cursor;
 
-interpreter_meta flatten_bf(bf_op *ops, blob_cursor *out);
+/*
+ * Ops with offset operands come in variants for each width of operand, kept
+ * in the top bits of the opcode byte.  All the offsets of one op (a move and
+ * any multiply terms) share the same width.  Jump distances are always 32 bit,
+ * relative to the end of the jumping op.
+ *
+ * Bytecode can be saved to disk (see bytecode_file.h), so changing how any op
+ * is encoded means bumping BYTECODE_VERSION.
+ */
+enum operand_width {
+	OPERAND_8 = 0 << 6,
+	OPERAND_16 = 1 << 6,
+	OPERAND_32 = 2 << 6,
+	OPERAND_WORD = 3 << 6,  // ssize_t, for offsets too big for anything else
+};
+#define OPERAND_WIDTH_MASK (3 << 6)
+
+// The op an opcode byte is a variant of
+#define BYTECODE_OP(opcode) ((enum bf_op_type)((unsigned char)(opcode) & ~OPERAND_WIDTH_MASK))
+
+typedef int32_t jump_offset;
+
+inline static size_t offset_operand_size(char opcode) {
+	switch ((unsigned char)opcode & OPERAND_WIDTH_MASK) {
+		case OPERAND_8: return sizeof(int8_t);
+		case OPERAND_16: return sizeof(int16_t);
+		case OPERAND_32: return sizeof(int32_t);
+		default: return sizeof(ssize_t);
+	}
+}
+
+/*
+ * Reads an offset operand of the width the opcode calls for, and moves past it.
+ */
+inline static ssize_t read_offset_operand(char **operand, char opcode) {
+	ssize_t offset;
+	switch ((unsigned char)opcode & OPERAND_WIDTH_MASK) {
+		case OPERAND_8: offset = *(int8_t*)*operand; break;
+		case OPERAND_16: offset = *(int16_t*)*operand; break;
+		case OPERAND_32: offset = *(int32_t*)*operand; break;
+		default: offset = *(ssize_t*)*operand; break;
+	}
+	*operand += offset_operand_size(opcode);
+	return offset;
+}
+
+inline static ssize_t read_jump_operand(char **operand) {
+	ssize_t offset = *(jump_offset*)*operand;
+	*operand += sizeof(jump_offset);
+	return offset;
+}
+
+/*
+ * Runs a DIVIDE, whose operands are the negated inverse of the odd part of the
+ * loop's step and the number of zero bits below it, turning the cell into the
+ * number of times the loop would have run.  Returns false if it would never
+ * have stopped, leaving the cell alone.
+ */
+inline static bool divide_cell(cell_int *cell, cell_int multiplier, unsigned shift) {
+	uint64_t mask = UINT64_MAX >> (64 - CHAR_BIT * sizeof(cell_int));
+	uint64_t value = (uint64_t)*cell & mask;
+	if (value & (((uint64_t)1 << shift) - 1))
+		return false;
+	*cell = (cell_int)(((value * (uint64_t)multiplier) & mask) >> shift);
+	return true;
+}
+
+// Multiplies cells together, wrapping round as a cell would
+inline static cell_int multiply_cells(cell_int a, cell_int b, cell_int c) {
+	return (cell_int)((uint64_t)a * (uint64_t)b * (uint64_t)c);
+}
+
+/*
+ * Where each op in the bytecode came from in the source, in order of address.
+ * Ops which got fused together share one entry, at the address of the first.
+ */
+typedef struct {
+	size_t address;
+	source_range source;
+} source_map_entry;
+
+typedef struct {
+	source_map_entry *entries;
+	size_t len, alloc;
+} source_map;
+
+source_range source_map_find(source_map const *map, size_t address);
+
+interpreter_meta flatten_bf(bf_op *ops, blob_cursor *out, source_map *map);
+size_t bytecode_op_size(char *op);
+size_t bytecode_length(char *bytecode);
 
 #endif
@@ -1,5 +1,6 @@
 #include <stdbool.h>
 #include <stdint.h>
+#include <inttypes.h>
 #include <stdio.h>
 #include <string.h>
 #include <err.h>
@@ -7,125 +8,163 @@
 #include "assert2.h"
 #include "interpreter.h"
 #include "brainfuck.h"
-
-#ifdef FIXED_TAPE_SIZE
-typedef struct {
-	FIXED_TAPE_SIZE pos;
-	cell_int *restrict cells;
-} tape_struct;
+#include "tape.h"
+#include "jit.h"
+#include "flattener.h"
+#include "debug.h"
+#include "profile.h"
+
+#ifdef __GNUC__
+#define ALWAYS_INLINE inline __attribute__((always_inline))
 #else
-typedef struct {
-	size_t back_size;  // Amount of tape corresponding to negative offsets (used for smarter reallocation purposes)
-	size_t front_size; // Amount of tape corresponding to positive offsets (used for smarter reallocation purposes)
-	size_t pos;
-	cell_int *restrict cells;
-#if !defined(NDEBUG) && !defined(FIXED_TAPE_SIZE)
-	size_t bound_upper, bound_lower;
-#endif
-} tape_struct;
+#define ALWAYS_INLINE inline
 #endif
 
-#ifndef FIXED_TAPE_SIZE
-inline static void tape_ensure_space(tape_struct *restrict tape, ssize_t pos, interpreter_meta *meta) {
-	if (pos + meta->lowest_negative_skip < 0) {
-		pos += meta->lowest_negative_skip;  // Always let skips skip without bounds checking
-		size_t old_back_size = tape->back_size;
-		while (pos < 0) {
-			pos += tape->back_size;
-			tape->back_size *= 2;
-		}
-		size_t extra_size = tape->back_size - old_back_size;
-		size_t total_size = tape->back_size + tape->front_size;
-		tape->cells = realloc(tape->cells, total_size * sizeof *tape->cells);
-		memmove(tape->cells + extra_size, tape->cells, (tape->front_size + old_back_size) * sizeof *tape->cells);
-		memset(tape->cells, 0, extra_size * sizeof *tape->cells);
+// Number of times a loop must jump back to its start before it is compiled
+#define TIERED_JIT_THRESHOLD 1000
+
+typedef struct {
+	char *bytecode;
+	uint32_t *back_edge_counts;  // Indexed by bytecode address. Once compiled, this is an index into "loops" instead.
+	jit_code *loops;
+	size_t loop_count, loop_alloc;
+} tier_state;
+
+/*
+ * Compiles the loop ending at the given JUMPIFNONZERO (or MOVE_JUMPIFNONZERO),
+ * and patches the jump so that the interpreter runs the native code from now
+ * on.  Returns false if the loop could not be compiled.
+ */
+static bool tier_up(tier_state *restrict tiers, char *restrict jump, interpreter_meta *meta) {
+	// The jump offset is always the last operand
+	size_t end = jump - tiers->bytecode + bytecode_op_size(jump);
+	size_t start = end + *(jump_offset*)&tiers->bytecode[end - sizeof(jump_offset)];
+
+	if (tiers->loop_count == tiers->loop_alloc) {
+		tiers->loop_alloc = tiers->loop_alloc ? tiers->loop_alloc * 2 : 16;
+		tiers->loops = realloc(tiers->loops, tiers->loop_alloc * sizeof *tiers->loops);
+	}
+	if (!jit_compile(tiers->bytecode, start, end, meta, &tiers->loops[tiers->loop_count]))
+		return false;
 
-		tape->pos += extra_size;
+	tiers->back_edge_counts[jump - tiers->bytecode] = tiers->loop_count++;
+	enum bf_op_type native = BYTECODE_OP(*jump) == BF_OP_MOVE_JUMPIFNONZERO ? BF_OP_MOVE_NATIVE_LOOP : BF_OP_NATIVE_LOOP;
+	*jump = native | (*jump & OPERAND_WIDTH_MASK);
+	return true;
+}
+
+static void run_native_loop(tier_state *restrict tiers, char *restrict jump, tape_struct *restrict tape, interpreter_meta *meta, bf_io *io) {
+	jit_run(&tiers->loops[tiers->back_edge_counts[jump - tiers->bytecode]], tape, meta, io);
 #if !defined(NDEBUG) && !defined(FIXED_TAPE_SIZE)
-		tape->bound_upper += extra_size;
-		// tape->bound_lower += extra_size; // XXX assuming checking left means bound_lower will be overwritten
+	// Native code doesn't keep track of the checked bounds
+	tape->bound_lower = 0;
+	tape->bound_upper = tape->back_size + tape->front_size - 1;
 #endif
-	} else if (pos + meta->highest_positive_skip >= (ssize_t)(tape->back_size + tape->front_size)) {
-		pos += meta->highest_positive_skip;  // Always let skips skip without bounds checking
-		size_t old_front_size = tape->front_size;
-
-		size_t total_size = tape->front_size + tape->back_size;
-		while ((size_t)pos >= total_size) {
-			total_size += tape->front_size;
-			tape->front_size *= 2;
-		}
+}
 
-		size_t extra_size = tape->front_size - old_front_size;
-		tape->cells = realloc(tape->cells, total_size * sizeof *tape->cells);
-		memset(tape->cells + old_front_size + tape->back_size, 0, extra_size * sizeof *tape->cells);
+/*
+ * Takes the backwards jump at the end of a loop, given the address just past
+ * the jump, and returns where to carry on from.  When tiering, a loop which
+ * has become hot is compiled and then run natively to completion instead.
+ */
+static ALWAYS_INLINE char *take_back_edge(tier_state *restrict tiers, char *restrict jump, char *restrict next,
+		tape_struct *restrict tape, interpreter_meta *meta, bf_io *io, bool tiered) {
+	if (tiered && ++tiers->back_edge_counts[jump - tiers->bytecode] == TIERED_JIT_THRESHOLD
+			&& tier_up(tiers, jump, meta)) {
+		run_native_loop(tiers, jump, tape, meta, io);
+		return next;
 	}
+	return next + *(jump_offset*)(next - sizeof(jump_offset));
 }
-#endif
 
-void execute_bf(char *restrict what, interpreter_meta meta) {
-	tape_struct tape = {
-#ifndef FIXED_TAPE_SIZE
-		.pos = 16 - meta.lowest_negative_skip,
-		.back_size = 16 - meta.lowest_negative_skip,
-		.front_size = 16 + meta.highest_positive_skip,
-#ifndef NDEBUG
-		.bound_upper = 16 - meta.lowest_negative_skip,
-		.bound_lower = 16 - meta.lowest_negative_skip,
-#endif
-#else // else if defined FIXED_TAPE_SIZE
-		.pos = 16,
-#endif
-	};
-#ifdef FIXED_TAPE_SIZE
-	(void)meta;
-	tape.cells = calloc(sizeof *tape.cells, (size_t)256 << sizeof(FIXED_TAPE_SIZE));
-#else
-	tape.cells = calloc(sizeof *tape.cells, tape.front_size + tape.back_size);
-#endif
+typedef struct {
+	uint64_t pairs[BF_OP_COUNT][BF_OP_COUNT];
+	uint64_t triples[BF_OP_COUNT][BF_OP_COUNT][BF_OP_COUNT];
+	char *fallthrough;  // Where execution goes if the previous op doesn't jump
+	int previous[2];  // The last two ops run back to back, most recent first, or -1
+} sequence_counts;
+
+/*
+ * Records the op about to run at the given address.  Only ops which run one
+ * straight after the other in the bytecode are counted together, since those
+ * are the only ones which could be fused into one op.
+ */
+static void count_sequence(sequence_counts *restrict counts, char *restrict op) {
+	if (op != counts->fallthrough)
+		counts->previous[0] = counts->previous[1] = -1;
+
+	int current = BYTECODE_OP(*op);
+	if (counts->previous[0] != -1) {
+		counts->pairs[counts->previous[0]][current]++;
+		if (counts->previous[1] != -1)
+			counts->triples[counts->previous[1]][counts->previous[0]][current]++;
+	}
 
-	while (true) {
-#if !defined(NDEBUG) && !defined(FIXED_TAPE_SIZE)
-		if (tape.pos < tape.bound_lower || tape.pos > tape.bound_upper)
-			errx(2, "Bounds check failure. Pos: %zu, expected <%zu - %zu>\n", tape.pos, tape.bound_lower, tape.bound_upper);
-#endif
-		switch (*what++) {
-			case BF_OP_ALTER: {
-				ssize_t offset = *(ssize_t*)what;
-				what += sizeof(ssize_t);
-				cell_int amount = *(cell_int*)what;
-				what += sizeof(cell_int);
+	counts->previous[1] = counts->previous[0];
+	counts->previous[0] = current;
+	counts->fallthrough = op + bytecode_op_size(op);
+}
 
-				tape.pos += offset;
-				tape.cells[tape.pos] += amount;
-				break;
+static void print_sequence_counts(sequence_counts *restrict counts) {
+	for (int a = 0; a < BF_OP_COUNT; a++) {
+		for (int b = 0; b < BF_OP_COUNT; b++) {
+			if (counts->pairs[a][b])
+				fprintf(stderr, "pair %s %s %" PRIu64 "\n",
+					flattened_op_name(a), flattened_op_name(b), counts->pairs[a][b]);
+			for (int c = 0; c < BF_OP_COUNT; c++) {
+				if (counts->triples[a][b][c])
+					fprintf(stderr, "triple %s %s %s %" PRIu64 "\n",
+						flattened_op_name(a), flattened_op_name(b), flattened_op_name(c), counts->triples[a][b][c]);
 			}
+		}
+	}
+}
 
-#ifndef FIXED_TAPE_SIZE
-			case BF_OP_BOUNDS_CHECK: {
-				ssize_t offset = *(ssize_t*)what;
-				what += sizeof(ssize_t);
-
-				tape_ensure_space(&tape, tape.pos + offset, &meta);
+static ALWAYS_INLINE void run_bf(char *restrict what, interpreter_meta meta, bf_io *restrict io, bool tiered,
+		sequence_counts *restrict counts, op_profile *restrict profile) {
+	tape_struct tape;
+	tape_init(&tape, &meta);
 
-#ifndef NDEBUG
-				if (offset < 0) {
-					tape.bound_lower = tape.pos + offset;
-				} else {
-					tape.bound_upper = tape.pos + offset;
-				}
-#endif
+	tier_state tiers = {0};
+	if (tiered) {
+		tiers.bytecode = what;
+		tiers.back_edge_counts = calloc(bytecode_length(what), sizeof *tiers.back_edge_counts);
+	}
 
-				break;
-			}
+	while (true) {
+#if !defined(NDEBUG) && !defined(FIXED_TAPE_SIZE)
+		if (tape.pos < tape.bound_lower || tape.pos > tape.bound_upper)
+			errx(2, "Bounds check failure. Pos: %zu, expected <%zu - %zu>\n", tape.pos, tape.bound_lower, tape.bound_upper);
 #endif
-
-			case BF_OP_ALTER_MOVEONLY: {
-				ssize_t offset = *(ssize_t*)what;
-				what += sizeof(ssize_t);
-
-				tape.pos += offset;
-				break;
-			}
+		if (counts)
+			count_sequence(counts, what);
+		if (profile)
+			profile_op(profile, what);
+
+		switch ((unsigned char)*what++) {
+#define OFFSET_WIDTH OPERAND_8
+#define offset_int int8_t
+#include "interpreter_offset_ops.h"
+#undef OFFSET_WIDTH
+#undef offset_int
+
+#define OFFSET_WIDTH OPERAND_16
+#define offset_int int16_t
+#include "interpreter_offset_ops.h"
+#undef OFFSET_WIDTH
+#undef offset_int
+
+#define OFFSET_WIDTH OPERAND_32
+#define offset_int int32_t
+#include "interpreter_offset_ops.h"
+#undef OFFSET_WIDTH
+#undef offset_int
+
+#define OFFSET_WIDTH OPERAND_WORD
+#define offset_int ssize_t
+#include "interpreter_offset_ops.h"
+#undef OFFSET_WIDTH
+#undef offset_int
 
 			case BF_OP_ALTER_ADDONLY: {
 				cell_int amount = *(cell_int*)what;
@@ -135,27 +174,8 @@ void execute_bf(char *restrict what, interpreter_meta meta) {
 				break;
 			}
 
-			case BF_OP_MULTIPLY: {
-				uint8_t repeat = *(uint8_t*)what;
-				what++;
-				cell_int orig = tape.cells[tape.pos];
-				do {
-					ssize_t offset = *(ssize_t*)what;
-					what += sizeof(ssize_t);
-					cell_int amount = *(cell_int*)what;
-					what += sizeof(cell_int);
-
-					if (orig == 0) {
-						what += (sizeof(ssize_t) + sizeof(cell_int)) * repeat;
-						break;
-					}
-					tape.cells[tape.pos + offset] += orig * amount;
-				} while (repeat--);
-
-				// Fallthrough to set
-			}
-
-			case BF_OP_SET: {
+			case BF_OP_SET:
+			op_set: {
 				cell_int amount = *(cell_int*)what;
 				what += sizeof(cell_int);
 
@@ -163,49 +183,32 @@ void execute_bf(char *restrict what, interpreter_meta meta) {
 				break;
 			}
 
-			case BF_OP_SET_MULTI: {
-				ssize_t offset = *(ssize_t*)what;
-				what += sizeof(ssize_t);
-				cell_int amount = *(cell_int*)what;
+			case BF_OP_DIVIDE: {
+				cell_int multiplier = *(cell_int*)what;
 				what += sizeof(cell_int);
+				uint8_t shift = *(uint8_t*)what;
+				what++;
 
-				for (ssize_t i = 0; i <= offset; i++)
-					tape.cells[tape.pos + i] = amount;
+				if (!divide_cell(&tape.cells[tape.pos], multiplier, shift))
+					io_hang(io);
 				break;
 			}
 
 			case BF_OP_IN: {
-				int input = getchar();
+				int input = input_byte(io);
 				if (input == EOF && sizeof(cell_int) == 1) input = 0;
 				tape.cells[tape.pos] = input;
 				break;
 			}
 
 			case BF_OP_OUT:
-				putchar(tape.cells[tape.pos]);
+				output_byte(&io->out, tape.cells[tape.pos]);
 				break;
 
 
-			case BF_OP_SKIP: {
-				ssize_t offset = *(ssize_t*)what;
-				what += sizeof(ssize_t);
-
-				while (tape.cells[tape.pos] != 0) {
-					tape.pos += offset;
-				}
-
-#if !defined(NDEBUG) && !defined(FIXED_TAPE_SIZE)
-				if (offset < 0)
-					tape.bound_lower = tape.pos;
-				else
-					tape.bound_upper = tape.pos;
-#endif
-				break;
-			}
-
 			case BF_OP_JUMPIFZERO: {
-				ssize_t offset = *(ssize_t*)what;
-				what += sizeof(ssize_t);
+				ssize_t offset = *(jump_offset*)what;
+				what += sizeof(jump_offset);
 				if (tape.cells[tape.pos] == 0) {
 					what += offset;
 				}
@@ -213,16 +216,35 @@ void execute_bf(char *restrict what, interpreter_meta meta) {
 			}
 
 			case BF_OP_JUMPIFNONZERO: {
-				ssize_t offset = *(ssize_t*)what;
-				what += sizeof(ssize_t);
-				if (tape.cells[tape.pos] != 0) {
-					what += offset;
-				}
+				char *jump = what - 1;
+				what += sizeof(jump_offset);
+				if (tape.cells[tape.pos] != 0)
+					what = take_back_edge(&tiers, jump, what, &tape, &meta, io, tiered);
+				break;
+			}
+
+			case BF_OP_NATIVE_LOOP: {
+				assert(tiered);
+				char *jump = what - 1;
+				what += sizeof(jump_offset);
+				if (tape.cells[tape.pos] != 0)
+					run_native_loop(&tiers, jump, &tape, &meta, io);
 				break;
 			}
 
 			case BF_OP_DIE:
-				free(tape.cells);
+				if (tiered) {
+					for (size_t i = 0; i < tiers.loop_count; i++)
+						jit_free(&tiers.loops[i]);
+					free(tiers.loops);
+					free(tiers.back_edge_counts);
+				}
+#ifndef FIXED_TAPE_SIZE
+				if (profile)
+					profile->reallocations = tape.reallocations;
+#endif
+				output_flush(&io->out);
+				tape_free(&tape);
 				return;
 
 			default:
@@ -230,3 +252,28 @@ void execute_bf(char *restrict what, interpreter_meta meta) {
 		}
 	}
 }
+
+void execute_bf(char *restrict what, interpreter_meta meta, bf_io *io) {
+	run_bf(what, meta, io, false, NULL, NULL);
+}
+
+void execute_bf_tiered(char *restrict what, interpreter_meta meta, bf_io *io) {
+	if (!JIT_AVAILABLE) {
+		warnx("JIT compilation is not available in this build; interpreting without it.");
+		run_bf(what, meta, io, false, NULL, NULL);
+		return;
+	}
+	run_bf(what, meta, io, true, NULL, NULL);
+}
+
+void execute_bf_counting(char *restrict what, interpreter_meta meta, bf_io *io) {
+	sequence_counts *counts = calloc(1, sizeof *counts);
+	counts->previous[0] = counts->previous[1] = -1;
+	run_bf(what, meta, io, false, counts, NULL);
+	print_sequence_counts(counts);
+	free(counts);
+}
+
+void execute_bf_profiling(char *restrict what, interpreter_meta meta, bf_io *io, op_profile *profile) {
+	run_bf(what, meta, io, false, NULL, profile);
+}
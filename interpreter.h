@@ -3,11 +3,31 @@
 
 #include <sys/types.h>
 
+#include "io.h"
+#include "variant.h"
+
+enum tape_kind {
+	TAPE_REALLOC,  // Grown with realloc whenever a bounds check finds it too small
+	TAPE_VM,       // A huge reservation, committed as the program touches it, with no bounds checks
+	TAPE_VM_HUGE,  // As above, backed by transparent huge pages where possible
+	TAPE_FIXED_256,    // 256 cells, with the position wrapping around at the ends (a FIXED_TAPE_SIZE variant)
+	TAPE_FIXED_65536,  // As above, with 65536 cells
+};
+
 typedef struct {
 	ssize_t lowest_negative_skip;
 	ssize_t highest_positive_skip;
+	enum tape_kind tape_kind;
 } interpreter_meta;
 
-void execute_bf(char *bytecode, interpreter_meta meta);
+void execute_bf(char *bytecode, interpreter_meta meta, bf_io *io);
+void execute_bf_threaded(char *bytecode, interpreter_meta meta, bf_io *io);
+void execute_bf_jit(char *bytecode, interpreter_meta meta, bf_io *io);
+void execute_bf_tiered(char *bytecode, interpreter_meta meta, bf_io *io);
+void execute_bf_counting(char *bytecode, interpreter_meta meta, bf_io *io);
+
+struct op_profile;
+// Runs the program, counting what runs in a profile set up with profile_init
+void execute_bf_profiling(char *bytecode, interpreter_meta meta, bf_io *io, struct op_profile *profile);
 
 #endif
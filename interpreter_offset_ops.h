@@ -0,0 +1,188 @@
+/*
+ * The cases of the switch in run_bf for the ops with offset operands, for
+ * one width of operand.  interpreter.c includes this once for each width,
+ * with OFFSET_WIDTH set to the enum operand_width and offset_int to the type
+ * its operands are stored as.
+ */
+
+			case BF_OP_ALTER | OFFSET_WIDTH: {
+				ssize_t offset = *(offset_int*)what;
+				what += sizeof(offset_int);
+				cell_int amount = *(cell_int*)what;
+				what += sizeof(cell_int);
+
+				tape.pos += offset;
+				tape.cells[tape.pos] += amount;
+				break;
+			}
+
+#ifndef FIXED_TAPE_SIZE
+			case BF_OP_BOUNDS_CHECK | OFFSET_WIDTH: {
+				ssize_t offset = *(offset_int*)what;
+				what += sizeof(offset_int);
+
+				tape_ensure_space(&tape, tape.pos + offset, &meta);
+
+#ifndef NDEBUG
+				if (offset < 0) {
+					tape.bound_lower = tape.pos + offset;
+				} else {
+					tape.bound_upper = tape.pos + offset;
+				}
+#endif
+
+				break;
+			}
+#endif
+
+			case BF_OP_ADD_AT | OFFSET_WIDTH: {
+				ssize_t offset = *(offset_int*)what;
+				what += sizeof(offset_int);
+				cell_int amount = *(cell_int*)what;
+				what += sizeof(cell_int);
+
+				tape.cells[TAPE_INDEX(tape.pos, offset)] += amount;
+				break;
+			}
+
+			case BF_OP_SET_AT | OFFSET_WIDTH: {
+				ssize_t offset = *(offset_int*)what;
+				what += sizeof(offset_int);
+				cell_int amount = *(cell_int*)what;
+				what += sizeof(cell_int);
+
+				tape.cells[TAPE_INDEX(tape.pos, offset)] = amount;
+				break;
+			}
+
+			case BF_OP_IN_AT | OFFSET_WIDTH: {
+				ssize_t offset = *(offset_int*)what;
+				what += sizeof(offset_int);
+
+				int input = input_byte(io);
+				if (input == EOF && sizeof(cell_int) == 1) input = 0;
+				tape.cells[TAPE_INDEX(tape.pos, offset)] = input;
+				break;
+			}
+
+			case BF_OP_OUT_AT | OFFSET_WIDTH: {
+				ssize_t offset = *(offset_int*)what;
+				what += sizeof(offset_int);
+
+				output_byte(&io->out, tape.cells[TAPE_INDEX(tape.pos, offset)]);
+				break;
+			}
+
+			case BF_OP_WRITE_CONST | OFFSET_WIDTH: {
+				size_t length = *(offset_int*)what;
+				what += sizeof(offset_int);
+
+				output_bytes(&io->out, what, length);
+				what += length;
+				break;
+			}
+
+			case BF_OP_ALTER_MOVEONLY | OFFSET_WIDTH: {
+				ssize_t offset = *(offset_int*)what;
+				what += sizeof(offset_int);
+
+				tape.pos += offset;
+				break;
+			}
+
+			case BF_OP_MOVE_MULTIPLY | OFFSET_WIDTH:
+				tape.pos += *(offset_int*)what;
+				what += sizeof(offset_int);
+				// Fallthrough
+
+			case BF_OP_MULTIPLY | OFFSET_WIDTH: {
+				uint8_t repeat = *(uint8_t*)what;
+				what++;
+				cell_int orig = tape.cells[tape.pos];
+				do {
+					ssize_t offset = *(offset_int*)what;
+					what += sizeof(offset_int);
+					cell_int amount = *(cell_int*)what;
+					what += sizeof(cell_int);
+
+					if (orig == 0) {
+						what += (sizeof(offset_int) + sizeof(cell_int)) * repeat;
+						break;
+					}
+					tape.cells[TAPE_INDEX(tape.pos, offset)] += orig * amount;
+				} while (repeat--);
+
+				goto op_set;
+			}
+
+			case BF_OP_PRODUCT | OFFSET_WIDTH: {
+				ssize_t offset = *(offset_int*)what;
+				what += sizeof(offset_int);
+				ssize_t factor = *(offset_int*)what;
+				what += sizeof(offset_int);
+				cell_int amount = *(cell_int*)what;
+				what += sizeof(cell_int);
+
+				tape.cells[TAPE_INDEX(tape.pos, offset)] += multiply_cells(tape.cells[tape.pos], tape.cells[TAPE_INDEX(tape.pos, factor)], amount);
+				break;
+			}
+
+			case BF_OP_SET_MULTI | OFFSET_WIDTH: {
+				ssize_t offset = *(offset_int*)what;
+				what += sizeof(offset_int);
+				cell_int amount = *(cell_int*)what;
+				what += sizeof(cell_int);
+
+				for (ssize_t i = 0; i <= offset; i++)
+					tape.cells[TAPE_INDEX(tape.pos, i)] = amount;
+				break;
+			}
+
+			case BF_OP_SKIP | OFFSET_WIDTH: {
+				ssize_t offset = *(offset_int*)what;
+				what += sizeof(offset_int);
+
+				tape_skip(&tape, offset);
+				break;
+			}
+
+			case BF_OP_CLEAR_RUN | OFFSET_WIDTH: {
+				ssize_t offset = *(offset_int*)what;
+				what += sizeof(offset_int);
+
+				tape_clear_run(&tape, offset);
+				break;
+			}
+
+			case BF_OP_SHIFT_RUN | OFFSET_WIDTH: {
+				ssize_t offset = *(offset_int*)what;
+				what += sizeof(offset_int);
+				ssize_t distance = *(offset_int*)what;
+				what += sizeof(offset_int);
+
+				tape_shift_run(&tape, offset, distance);
+				break;
+			}
+
+			case BF_OP_MOVE_JUMPIFNONZERO | OFFSET_WIDTH: {
+				char *jump = what - 1;
+				ssize_t offset = *(offset_int*)what;
+				what += sizeof(offset_int) + sizeof(jump_offset);
+
+				tape.pos += offset;
+				if (tape.cells[tape.pos] != 0)
+					what = take_back_edge(&tiers, jump, what, &tape, &meta, io, tiered);
+				break;
+			}
+
+			case BF_OP_MOVE_NATIVE_LOOP | OFFSET_WIDTH: {
+				assert(tiered);
+				char *jump = what - 1;
+				ssize_t offset = *(offset_int*)what;
+				what += sizeof(offset_int) + sizeof(jump_offset);
+
+				tape.pos += offset;
+				if (tape.cells[tape.pos] != 0)
+					run_native_loop(&tiers, jump, &tape, &meta, io);
+				break;
+			}
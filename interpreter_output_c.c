@@ -1,12 +1,19 @@
+#include <err.h>
+#include <inttypes.h>
+#include <stdbool.h>
 #include <stdio.h>
 
 #include "assert2.h"
 #include "interpreter.h"
 #include "brainfuck.h"
+#include "flattener.h"
 
 #define CPP_STRINGIFY2(x) #x
 #define CPP_STRINGIFY(x) CPP_STRINGIFY2(x)
 #ifdef FIXED_TAPE_SIZE
+// The cell at an offset from the position, which wraps around with it
+#define AT_OFFSET(offset) "tape.cells[(" CPP_STRINGIFY(FIXED_TAPE_SIZE) ")(tape.pos + " offset ")]"
+
 typedef struct {
 	FIXED_TAPE_SIZE pos;
 	cell_int *restrict cells;
@@ -21,17 +28,70 @@ typedef struct {
 	size_t bound_upper, bound_lower;
 #endif
 } tape_struct;
+
+#define AT_OFFSET(offset) "tape.cells[tape.pos + " offset "]"
 #endif
 
-void execute_bf(char *restrict what, interpreter_meta meta) {
+static void output_runtime(enum output_buffering buffering) {
+	puts("static char output_buffer[" CPP_STRINGIFY(OUTPUT_BUFFER_SIZE) "];\n"
+	     "static size_t output_pos;");
+	if (buffering == BUFFER_AUTO)
+		puts("static int line_buffered;");
+
+	puts("\n"
+	     "static void flush_output(void) {\n"
+	     "	size_t done = 0;\n"
+	     "	while (done < output_pos) {\n"
+	     "		ssize_t written = write(1, output_buffer + done, output_pos - done);\n"
+	     "		if (written < 0) {\n"
+	     "			if (errno == EINTR) continue;\n"
+	     "			perror(\"Can't write output\");\n"
+	     "			exit(1);\n"
+	     "		}\n"
+	     "		done += written;\n"
+	     "	}\n"
+	     "	output_pos = 0;\n"
+	     "}\n"
+	     "\n"
+	     "static inline void output(char c) {\n"
+	     "	output_buffer[output_pos++] = c;");
+	switch (buffering) {
+		case BUFFER_AUTO:
+			puts("	if (output_pos == sizeof output_buffer || (line_buffered && c == '\\n'))");
+			break;
+		case BUFFER_LINE:
+			puts("	if (output_pos == sizeof output_buffer || c == '\\n')");
+			break;
+		case BUFFER_FULL:
+			puts("	if (output_pos == sizeof output_buffer)");
+			break;
+	}
+	puts("		flush_output();\n"
+	     "}\n"
+	     "\n"
+	     "static inline void output_text(char const *text, size_t length) {\n"
+	     "	for (size_t i = 0; i < length; i++)\n"
+	     "		output(text[i]);\n"
+	     "}\n");
+}
+
+void execute_bf(char *what, interpreter_meta meta, bf_io *io) {
+	bool reserved = meta.tape_kind == TAPE_VM || meta.tape_kind == TAPE_VM_HUGE;
+	if (reserved)
+		puts("#define _DEFAULT_SOURCE\n"
+		     "#include <sys/mman.h>");
 	puts("#include <stdio.h>\n"
 	     "#include <stdlib.h>\n"
-	     "#include <stdint.h>");
+	     "#include <stdint.h>\n"
+	     "#include <errno.h>\n"
+	     "#include <unistd.h>");
 #ifndef NDEBUG
 	puts("#include <err.h>");
 #endif
 #ifndef FIXED_TAPE_SIZE
 	puts("#include <string.h>");
+#else
+	puts("#include <limits.h>");
 #endif
 	puts("");
 
@@ -60,51 +120,83 @@ void execute_bf(char *restrict what, interpreter_meta meta) {
 	     "} tape_struct;\n");
 
 	// Tape reallocator
-	puts("static void tape_ensure_space(tape_struct *restrict tape, ssize_t pos) {\n"
-	     "	if (pos + LOWEST_NEGATIVE_SKIP < 0) {\n"
-	     "		pos += LOWEST_NEGATIVE_SKIP;  // Always let skips skip without bounds checking\n"
-	     "		size_t old_back_size = tape->back_size;\n"
-	     "		while (pos < 0) {\n"
-	     "			pos += tape->back_size;\n"
-	     "			tape->back_size *= 2;\n"
-	     "		}\n"
-	     "		size_t extra_size = tape->back_size - old_back_size;\n"
-	     "		size_t total_size = tape->back_size + tape->front_size;\n"
-	     "		tape->cells = realloc(tape->cells, total_size * sizeof *tape->cells);\n"
-	     "		memmove(tape->cells + extra_size, tape->cells, (tape->front_size + old_back_size) * sizeof *tape->cells);\n"
-	     "		memset(tape->cells, 0, extra_size * sizeof *tape->cells);\n"
-	     "\n"
-	     "		tape->pos += extra_size;\n"
+	if (!reserved) {
+		puts("static void tape_ensure_space(tape_struct *restrict tape, ssize_t pos) {\n"
+		     "	if (pos + LOWEST_NEGATIVE_SKIP < 0) {\n"
+		     "		pos += LOWEST_NEGATIVE_SKIP;  // Always let skips skip without bounds checking\n"
+		     "		size_t old_back_size = tape->back_size;\n"
+		     "		while (pos < 0) {\n"
+		     "			pos += tape->back_size;\n"
+		     "			tape->back_size *= 2;\n"
+		     "		}\n"
+		     "		size_t extra_size = tape->back_size - old_back_size;\n"
+		     "		size_t total_size = tape->back_size + tape->front_size;\n"
+		     "		tape->cells = realloc(tape->cells, total_size * sizeof *tape->cells);\n"
+		     "		memmove(tape->cells + extra_size, tape->cells, (tape->front_size + old_back_size) * sizeof *tape->cells);\n"
+		     "		memset(tape->cells, 0, extra_size * sizeof *tape->cells);\n"
+		     "\n"
+		     "		tape->pos += extra_size;\n"
 #ifndef NDEBUG
-	     "		tape->bound_upper += extra_size;\n"
+		     "		tape->bound_upper += extra_size;\n"
 #endif
-	     "	} else if (pos + HIGHEST_POSITIVE_SKIP >= (ssize_t)(tape->back_size + tape->front_size)) {\n"
-	     "		pos += HIGHEST_POSITIVE_SKIP;  // Always let skips skip without bounds checking\n"
-	     "		size_t old_front_size = tape->front_size;\n"
-	     "\n"
-	     "		size_t total_size = tape->front_size + tape->back_size;\n"
-	     "		while ((size_t)pos >= total_size) {\n"
-	     "			total_size += tape->front_size;\n"
-	     "			tape->front_size *= 2;\n"
-	     "		}\n"
-	     "\n"
-	     "		size_t extra_size = tape->front_size - old_front_size;\n"
-	     "		tape->cells = realloc(tape->cells, total_size * sizeof *tape->cells);\n"
-	     "		memset(tape->cells + old_front_size + tape->back_size, 0, extra_size * sizeof *tape->cells);\n"
-	     "	}\n"
-	     "}\n"
+		     "	} else if (pos + HIGHEST_POSITIVE_SKIP >= (ssize_t)(tape->back_size + tape->front_size)) {\n"
+		     "		pos += HIGHEST_POSITIVE_SKIP;  // Always let skips skip without bounds checking\n"
+		     "		size_t old_front_size = tape->front_size;\n"
+		     "\n"
+		     "		size_t total_size = tape->front_size + tape->back_size;\n"
+		     "		while ((size_t)pos >= total_size) {\n"
+		     "			total_size += tape->front_size;\n"
+		     "			tape->front_size *= 2;\n"
+		     "		}\n"
+		     "\n"
+		     "		size_t extra_size = tape->front_size - old_front_size;\n"
+		     "		tape->cells = realloc(tape->cells, total_size * sizeof *tape->cells);\n"
+		     "		memset(tape->cells + old_front_size + tape->back_size, 0, extra_size * sizeof *tape->cells);\n"
+		     "	}\n"
+		     "}\n");
+	}
+
 #ifndef NDEBUG
-	     "void bounds_check(tape_struct *restrict tape) {\n"
+	puts("void bounds_check(tape_struct *restrict tape) {\n"
 	     "	if (tape->pos < tape->bound_lower || tape->pos > tape->bound_upper)\n"
 	     "		errx(2, \"Bounds check failure. Pos: %zu, expected <%zu - %zu>\\n\", tape->pos, tape->bound_lower, tape->bound_upper);\n"
-	     "}\n"
+	     "}\n");
 #endif
-	);
 #endif
 
+	output_runtime(io->out.buffering);
+
 	// Main function
-	puts("int main(){\n"
-	     "	tape_struct tape = {\n"
+	puts("int main(){");
+#ifndef FIXED_TAPE_SIZE
+	if (reserved) {
+		// The generated program leaves committing the pages to the kernel
+		puts("	size_t tape_bytes = (size_t)1 << 36, guard = (size_t)2 << 20;\n"
+		     "	char *reservation = mmap(NULL, tape_bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);\n"
+		     "	if (reservation == MAP_FAILED) {\n"
+		     "		perror(\"Can't reserve address space for the tape\");\n"
+		     "		return 1;\n"
+		     "	}\n"
+		     "	mprotect(reservation, guard, PROT_NONE);\n"
+		     "	mprotect(reservation + tape_bytes - guard, guard, PROT_NONE);");
+		if (meta.tape_kind == TAPE_VM_HUGE)
+			puts("#ifdef MADV_HUGEPAGE\n"
+			     "	madvise(reservation + guard, tape_bytes - 2 * guard, MADV_HUGEPAGE);\n"
+			     "#endif");
+		puts("	size_t half = (tape_bytes / 2 - guard) / sizeof(" CPP_STRINGIFY(CELL_INT) ");\n"
+		     "	tape_struct tape = {\n"
+		     "		.back_size = half,\n"
+		     "		.front_size = half,\n"
+		     "		.pos = half,\n"
+		     "		.cells = (void*)(reservation + guard),\n"
+#ifndef NDEBUG
+		     "		.bound_upper = 2 * half - 1,\n"
+		     "		.bound_lower = 0,\n"
+#endif
+		     "	};");
+	} else
+#endif
+	puts("	tape_struct tape = {\n"
 #ifndef FIXED_TAPE_SIZE
 	     "		.pos = TAPE_INITIAL - LOWEST_NEGATIVE_SKIP,\n"
 	     "		.back_size = TAPE_INITIAL - LOWEST_NEGATIVE_SKIP,\n"
@@ -119,11 +211,13 @@ void execute_bf(char *restrict what, interpreter_meta meta) {
 	     "	};\n"
 
 #ifdef FIXED_TAPE_SIZE
-	     "	tape.cells = calloc(sizeof *tape.cells, (size_t)256 << sizeof(" CPP_STRINGIFY(FIXED_TAPE_SIZE) "));\n"
+	     "	tape.cells = calloc(sizeof *tape.cells, (size_t)2 << (CHAR_BIT * sizeof(" CPP_STRINGIFY(FIXED_TAPE_SIZE) ")));\n"
 #else
 	     "	tape.cells = calloc(sizeof *tape.cells, tape.front_size + tape.back_size);\n"
 #endif
 	);
+	if (io->out.buffering == BUFFER_AUTO)
+		puts("	line_buffered = isatty(1);");
 
 	char *ops_orig = what;
 	while (true) {
@@ -131,10 +225,10 @@ void execute_bf(char *restrict what, interpreter_meta meta) {
 #if !defined(NDEBUG) && !defined(FIXED_TAPE_SIZE)
 		puts("	bounds_check(&tape);\n");
 #endif
-		switch (*what++) {
+		char opcode = *what++;
+		switch (BYTECODE_OP(opcode)) {
 			case BF_OP_ALTER: {
-				ssize_t offset = *(ssize_t*)what;
-				what += sizeof(ssize_t);
+				ssize_t offset = read_offset_operand(&what, opcode);
 				cell_int amount = *(cell_int*)what;
 				what += sizeof(cell_int);
 
@@ -144,8 +238,7 @@ void execute_bf(char *restrict what, interpreter_meta meta) {
 
 #ifndef FIXED_TAPE_SIZE
 			case BF_OP_BOUNDS_CHECK: {
-				ssize_t offset = *(ssize_t*)what;
-				what += sizeof(ssize_t);
+				ssize_t offset = read_offset_operand(&what, opcode);
 
 				printf("	tape_ensure_space(&tape, tape.pos + %zd);\n", offset);
 
@@ -162,13 +255,30 @@ void execute_bf(char *restrict what, interpreter_meta meta) {
 #endif
 
 			case BF_OP_ALTER_MOVEONLY: {
-				ssize_t offset = *(ssize_t*)what;
-				what += sizeof(ssize_t);
+				ssize_t offset = read_offset_operand(&what, opcode);
 
 				printf("	tape.pos += %zd;\n", offset);
 				break;
 			}
 
+			case BF_OP_ADD_AT: {
+				ssize_t offset = read_offset_operand(&what, opcode);
+				cell_int amount = *(cell_int*)what;
+				what += sizeof(cell_int);
+
+				printf("	" AT_OFFSET("%zd") " += %d;\n", offset, (int)amount);
+				break;
+			}
+
+			case BF_OP_SET_AT: {
+				ssize_t offset = read_offset_operand(&what, opcode);
+				cell_int amount = *(cell_int*)what;
+				what += sizeof(cell_int);
+
+				printf("	" AT_OFFSET("%zd") " = %d;\n", offset, (int)amount);
+				break;
+			}
+
 			case BF_OP_ALTER_ADDONLY: {
 				cell_int amount = *(cell_int*)what;
 				what += sizeof(cell_int);
@@ -177,23 +287,26 @@ void execute_bf(char *restrict what, interpreter_meta meta) {
 				break;
 			}
 
+			case BF_OP_MOVE_MULTIPLY:
+				printf("	tape.pos += %zd;\n", read_offset_operand(&what, opcode));
+				// Fallthrough
+
 			case BF_OP_MULTIPLY: {
 				uint8_t repeat = *(uint8_t*)what;
 				what++;
 				puts("	{\n"
 				     "		" CPP_STRINGIFY(CELL_INT) " val = tape.cells[tape.pos];");
 				do {
-					ssize_t offset = *(ssize_t*)what;
-					what += sizeof(ssize_t);
+					ssize_t offset = read_offset_operand(&what, opcode);
 					cell_int amount = *(cell_int*)what;
 					what += sizeof(cell_int);
 
 					if (amount == 1) {
-						printf("		tape.cells[tape.pos + %zd] += val;\n", offset);
+						printf("		" AT_OFFSET("%zd") " += val;\n", offset);
 					} else if (amount == -1) {
-						printf("		tape.cells[tape.pos + %zd] -= val;\n", offset);
+						printf("		" AT_OFFSET("%zd") " -= val;\n", offset);
 					} else {
-						printf("		tape.cells[tape.pos + %zd] += val * %d;\n", offset, (int)amount);
+						printf("		" AT_OFFSET("%zd") " += val * %d;\n", offset, (int)amount);
 					}
 				} while (repeat--);
 				puts("	}");
@@ -209,14 +322,45 @@ void execute_bf(char *restrict what, interpreter_meta meta) {
 				break;
 			}
 
+			case BF_OP_PRODUCT: {
+				ssize_t offset = read_offset_operand(&what, opcode);
+				ssize_t factor = read_offset_operand(&what, opcode);
+				cell_int amount = *(cell_int*)what;
+				what += sizeof(cell_int);
+
+				printf("	" AT_OFFSET("%zd") " += (uint64_t)tape.cells[tape.pos] * (uint64_t)" AT_OFFSET("%zd") " * %#" PRIx64 "u;\n",
+				       offset, factor, (uint64_t)amount);
+				break;
+			}
+
+			case BF_OP_DIVIDE: {
+				cell_int multiplier = *(cell_int*)what;
+				what += sizeof(cell_int);
+				uint8_t shift = *(uint8_t*)what;
+				what++;
+
+				// As divide_cell does it
+				uint64_t mask = UINT64_MAX >> (64 - CHAR_BIT * sizeof(cell_int));
+				printf("	{\n"
+				       "		uint64_t count = (uint64_t)tape.cells[tape.pos] & %#" PRIx64 "u;\n"
+				       "		if (count & %#" PRIx64 "u) {\n"
+				       "			flush_output();\n"
+				       "			for (;;)\n"
+				       "				pause();\n"
+				       "		}\n"
+				       "		tape.cells[tape.pos] = ((count * %#" PRIx64 "u) & %#" PRIx64 "u) >> %u;\n"
+				       "	}\n",
+				       mask, ((uint64_t)1 << shift) - 1, (uint64_t)multiplier & mask, mask, (unsigned)shift);
+				break;
+			}
+
 			case BF_OP_SET_MULTI: {
-				ssize_t offset = *(ssize_t*)what;
-				what += sizeof(ssize_t);
+				ssize_t offset = read_offset_operand(&what, opcode);
 				cell_int amount = *(cell_int*)what;
 				what += sizeof(cell_int);
 
 				printf("	for (size_t i = 0; i <= %zd; i++)\n"
-				       "		tape.cells[tape.pos + i] = %d;\n",
+				       "		" AT_OFFSET("i") " = %d;\n",
 					offset, (int)amount);
 				break;
 			}
@@ -224,33 +368,77 @@ void execute_bf(char *restrict what, interpreter_meta meta) {
 			case BF_OP_IN:
 				if (sizeof(cell_int) == 1) {
 					puts("	{\n"
+					     "		flush_output();\n"
 					     "		int input = getchar();\n"
 					     "		if (input == EOF) input = 0;\n"
 					     "		tape.cells[tape.pos] = input;\n"
 					     "	}");
 				} else {
 					puts("	{\n"
+					     "		flush_output();\n"
 					     "		int input = getchar();\n"
 					     "		tape.cells[tape.pos] = input;\n"
 					     "	}");
 				}
 				break;
 
+			case BF_OP_IN_AT:
+				puts("	{\n"
+				     "		flush_output();\n"
+				     "		int input = getchar();");
+				if (sizeof(cell_int) == 1)
+					puts("		if (input == EOF) input = 0;");
+				printf("		" AT_OFFSET("%zd") " = input;\n"
+				       "	}\n",
+				       read_offset_operand(&what, opcode));
+				break;
+
 			case BF_OP_OUT:
-				puts("	putchar(tape.cells[tape.pos]);");
+				puts("	output(tape.cells[tape.pos]);");
+				break;
+
+			case BF_OP_OUT_AT:
+				printf("	output(" AT_OFFSET("%zd") ");\n", read_offset_operand(&what, opcode));
+				break;
+
+			case BF_OP_WRITE_CONST: {
+				size_t length = read_offset_operand(&what, opcode);
+
+				// Octal escapes, as hex ones would swallow any digits after them
+				printf("	output_text(\"");
+				for (size_t i = 0; i < length; i++) {
+					unsigned char c = what[i];
+					if (c == '"' || c == '\\' || c == '?')
+						printf("\\%c", c);
+					else if (c >= ' ' && c < 0x7F)
+						putchar(c);
+					else
+						printf("\\%03o", c);
+				}
+				printf("\", %zu);\n", length);
+				what += length;
 				break;
+			}
 
 
-			case BF_OP_SKIP: {
-				ssize_t offset = *(ssize_t*)what;
-				what += sizeof(ssize_t);
+			case BF_OP_SKIP:
+			case BF_OP_CLEAR_RUN:
+			case BF_OP_SHIFT_RUN: {
+				ssize_t offset = read_offset_operand(&what, opcode);
 
-				printf("	while (tape.cells[tape.pos] != 0) {\n"
-				       "		tape.pos += %zd;\n"
+				// Runs are left as loops, like skips, for the C compiler to make what it can of
+				printf("	while (tape.cells[tape.pos] != 0) {\n");
+				if (BYTECODE_OP(opcode) == BF_OP_SHIFT_RUN)
+					printf("		" AT_OFFSET("%zd") " += tape.cells[tape.pos];\n", read_offset_operand(&what, opcode));
+				if (BYTECODE_OP(opcode) != BF_OP_SKIP)
+					printf("		tape.cells[tape.pos] = 0;\n");
+				printf("		tape.pos += %zd;\n"
 				       "	}\n",
 				       offset);
 
 #if !defined(NDEBUG) && !defined(FIXED_TAPE_SIZE)
+				if (reserved)
+					break;
 				if (offset < 0)
 					printf("	tape.bound_lower = tape.pos;\n");
 				else
@@ -260,21 +448,24 @@ void execute_bf(char *restrict what, interpreter_meta meta) {
 			}
 
 			case BF_OP_JUMPIFZERO: {
-				ssize_t offset = *(ssize_t*)what;
-				what += sizeof(ssize_t);
+				ssize_t offset = read_jump_operand(&what);
 				printf("	if (!tape.cells[tape.pos]) goto instr_%08zx;\n", what + offset - ops_orig);
 				break;
 			}
 
+			case BF_OP_MOVE_JUMPIFNONZERO:
+				printf("	tape.pos += %zd;\n", read_offset_operand(&what, opcode));
+				// Fallthrough
+
 			case BF_OP_JUMPIFNONZERO: {
-				ssize_t offset = *(ssize_t*)what;
-				what += sizeof(ssize_t);
+				ssize_t offset = read_jump_operand(&what);
 				printf("	if (tape.cells[tape.pos]) goto instr_%08zx;\n", what + offset - ops_orig);
 				break;
 			}
 
 			case BF_OP_DIE:
-				puts("	return 0;\n"
+				puts("	flush_output();\n"
+				     "	return 0;\n"
 				     "}");
 				return;
 
@@ -283,3 +474,28 @@ void execute_bf(char *restrict what, interpreter_meta meta) {
 		}
 	}
 }
+
+// There is only one way to write out a C program
+void execute_bf_threaded(char *restrict what, interpreter_meta meta, bf_io *io) {
+	execute_bf(what, meta, io);
+}
+
+void execute_bf_jit(char *restrict what, interpreter_meta meta, bf_io *io) {
+	execute_bf(what, meta, io);
+}
+
+void execute_bf_tiered(char *restrict what, interpreter_meta meta, bf_io *io) {
+	execute_bf(what, meta, io);
+}
+
+void execute_bf_counting(char *restrict what, interpreter_meta meta, bf_io *io) {
+	execute_bf(what, meta, io);
+}
+
+void execute_bf_profiling(char *restrict what, interpreter_meta meta, bf_io *io, struct op_profile *profile) {
+	(void)what;
+	(void)meta;
+	(void)io;
+	(void)profile;
+	errx(1, "Can't profile a program which is written out as C");
+}
@@ -0,0 +1,369 @@
+/*
+ * Direct-threaded execution engine.
+ *
+ * The flattened bytecode is decoded once into an array of handler addresses
+ * with aligned operands, which is then executed by jumping straight from one
+ * handler to the next (computed goto), rather than going through the switch
+ * in interpreter.c for every op.
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <err.h>
+
+#include "assert2.h"
+#include "interpreter.h"
+#include "brainfuck.h"
+#include "tape.h"
+#include "flattener.h"
+
+#ifdef __GNUC__
+
+typedef struct threaded_op {
+	void const *handler;
+	ssize_t offset;
+	union {
+		cell_int amount;
+		size_t target_address;  // Jumps only, until they are resolved to a target
+		struct threaded_op *target;  // Jumps only
+		size_t terms;  // Multiplies only: number of term slots following this one
+		char const *text;  // Constant writes only, with the length in the offset
+		ssize_t distance;  // Shifting runs only, with the stride in the offset
+	};  // Products are followed by a slot holding the offset of the other factor
+} threaded_op;
+
+/*
+ * Gets the number of threaded ops the flattened op at the given position
+ * will be decoded into.
+ */
+static size_t threaded_slot_count(char *restrict op) {
+	if (BYTECODE_OP(*op) == BF_OP_MULTIPLY) {
+		// Header, the terms, then the SET it falls through into
+		return (size_t)*(uint8_t*)(op + 1) + 3;
+	}
+	if (BYTECODE_OP(*op) == BF_OP_MOVE_MULTIPLY)
+		return (size_t)*(uint8_t*)(op + 1 + offset_operand_size(*op)) + 3;
+	if (BYTECODE_OP(*op) == BF_OP_PRODUCT)
+		return 2;
+	return 1;
+}
+
+static threaded_op* decode_bf(char *restrict bytecode, void const *const *restrict handlers) {
+	// First pass: find out how big everything is
+	size_t length = bytecode_length(bytecode), slot_count = 0;
+	for (size_t address = 0; address < length; address += bytecode_op_size(&bytecode[address]))
+		slot_count += threaded_slot_count(&bytecode[address]);
+
+	threaded_op *program = malloc(slot_count * sizeof *program);
+	size_t *slot_for_address = malloc(length * sizeof *slot_for_address);
+
+	// Second pass: decode every op, keeping jump targets as bytecode addresses
+	size_t slot = 0;
+	for (size_t address = 0; address < length;) {
+		char *what = &bytecode[address];
+		size_t slots = threaded_slot_count(what);
+		size_t size = bytecode_op_size(what);
+		slot_for_address[address] = slot;
+
+		threaded_op *op = &program[slot];
+		char opcode = *what++;
+		op->handler = handlers[BYTECODE_OP(opcode)];
+		switch (BYTECODE_OP(opcode)) {
+			case BF_OP_ALTER:
+			case BF_OP_SET_MULTI:
+			case BF_OP_ADD_AT:
+			case BF_OP_SET_AT:
+				op->offset = read_offset_operand(&what, opcode);
+				op->amount = *(cell_int*)what;
+				break;
+
+			case BF_OP_BOUNDS_CHECK:
+			case BF_OP_ALTER_MOVEONLY:
+			case BF_OP_SKIP:
+			case BF_OP_CLEAR_RUN:
+			case BF_OP_IN_AT:
+			case BF_OP_OUT_AT:
+				op->offset = read_offset_operand(&what, opcode);
+				break;
+
+			case BF_OP_SHIFT_RUN:
+				op->offset = read_offset_operand(&what, opcode);
+				op->distance = read_offset_operand(&what, opcode);
+				break;
+
+			case BF_OP_PRODUCT:
+				op->offset = read_offset_operand(&what, opcode);
+				op[1].handler = NULL;
+				op[1].offset = read_offset_operand(&what, opcode);
+				op->amount = *(cell_int*)what;
+				break;
+
+			case BF_OP_WRITE_CONST:
+				op->offset = read_offset_operand(&what, opcode);
+				op->text = what;
+				break;
+
+			case BF_OP_DIVIDE:
+				op->amount = *(cell_int*)what;
+				op->offset = *(uint8_t*)(what + sizeof(cell_int));
+				break;
+
+			case BF_OP_MOVE_JUMPIFNONZERO:
+				op->offset = read_offset_operand(&what, opcode);
+				// Fallthrough
+
+			case BF_OP_JUMPIFZERO:
+			case BF_OP_JUMPIFNONZERO:
+				// Resolved to a slot in the third pass
+				op->target_address = address + size + read_jump_operand(&what);
+				break;
+
+			case BF_OP_ALTER_ADDONLY:
+			case BF_OP_SET:
+				op->amount = *(cell_int*)what;
+				break;
+
+			case BF_OP_MOVE_MULTIPLY:
+			case BF_OP_MULTIPLY: {
+				if (BYTECODE_OP(opcode) == BF_OP_MOVE_MULTIPLY)
+					op->offset = read_offset_operand(&what, opcode);
+				op->terms = slots - 2;
+				what++;
+				for (size_t i = 1; i <= op->terms; i++) {
+					op[i].handler = NULL;
+					op[i].offset = read_offset_operand(&what, opcode);
+					op[i].amount = *(cell_int*)what;
+					what += sizeof(cell_int);
+				}
+				threaded_op *set = &op[op->terms + 1];
+				set->handler = handlers[BF_OP_SET];
+				set->amount = *(cell_int*)what;
+				break;
+			}
+
+			default:
+				break;
+		}
+
+		address += size;
+		slot += slots;
+	}
+
+	// Third pass: point the jumps at their targets
+	for (size_t i = 0; i < slot_count; i++) {
+		threaded_op *op = &program[i];
+		if (op->handler == handlers[BF_OP_JUMPIFZERO] || op->handler == handlers[BF_OP_JUMPIFNONZERO]
+				|| op->handler == handlers[BF_OP_MOVE_JUMPIFNONZERO]) {
+			size_t target = op->target_address;
+			assert(target < length);
+			op->target = &program[slot_for_address[target]];
+		}
+	}
+
+	free(slot_for_address);
+	return program;
+}
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpedantic"
+
+void execute_bf_threaded(char *restrict bytecode, interpreter_meta meta, bf_io *restrict io) {
+	static void const *const handlers[] = {
+		[BF_OP_ALTER] = &&op_alter,
+		[BF_OP_IN] = &&op_in,
+		[BF_OP_OUT] = &&op_out,
+		[BF_OP_BOUNDS_CHECK] = &&op_bounds_check,
+		[BF_OP_SET] = &&op_set,
+		[BF_OP_SET_MULTI] = &&op_set_multi,
+		[BF_OP_MULTIPLY] = &&op_multiply,
+		[BF_OP_SKIP] = &&op_skip,
+		[BF_OP_ALTER_MOVEONLY] = &&op_alter_moveonly,
+		[BF_OP_ALTER_ADDONLY] = &&op_alter_addonly,
+		[BF_OP_JUMPIFNONZERO] = &&op_jumpifnonzero,
+		[BF_OP_JUMPIFZERO] = &&op_jumpifzero,
+		[BF_OP_DIE] = &&op_die,
+		[BF_OP_MOVE_MULTIPLY] = &&op_move_multiply,
+		[BF_OP_MOVE_JUMPIFNONZERO] = &&op_move_jumpifnonzero,
+		[BF_OP_DIVIDE] = &&op_divide,
+		[BF_OP_PRODUCT] = &&op_product,
+		[BF_OP_ADD_AT] = &&op_add_at,
+		[BF_OP_WRITE_CONST] = &&op_write_const,
+		[BF_OP_CLEAR_RUN] = &&op_clear_run,
+		[BF_OP_SHIFT_RUN] = &&op_shift_run,
+		[BF_OP_SET_AT] = &&op_set_at,
+		[BF_OP_IN_AT] = &&op_in_at,
+		[BF_OP_OUT_AT] = &&op_out_at,
+	};
+
+	threaded_op *program = decode_bf(bytecode, handlers);
+	threaded_op *restrict ip = program;
+
+	tape_struct tape;
+	tape_init(&tape, &meta);
+
+#if !defined(NDEBUG) && !defined(FIXED_TAPE_SIZE)
+#define DISPATCH() do { \
+		if (tape.pos < tape.bound_lower || tape.pos > tape.bound_upper) \
+			errx(2, "Bounds check failure. Pos: %zu, expected <%zu - %zu>\n", tape.pos, tape.bound_lower, tape.bound_upper); \
+		goto *ip->handler; \
+	} while (0)
+#else
+#define DISPATCH() goto *ip->handler
+#endif
+#define NEXT() do { ip++; DISPATCH(); } while (0)
+
+	DISPATCH();
+
+op_alter:
+	tape.pos += ip->offset;
+	tape.cells[tape.pos] += ip->amount;
+	NEXT();
+
+op_bounds_check:
+#ifndef FIXED_TAPE_SIZE
+	tape_ensure_space(&tape, tape.pos + ip->offset, &meta);
+
+#ifndef NDEBUG
+	if (ip->offset < 0) {
+		tape.bound_lower = tape.pos + ip->offset;
+	} else {
+		tape.bound_upper = tape.pos + ip->offset;
+	}
+#endif
+#endif
+	NEXT();
+
+op_alter_moveonly:
+	tape.pos += ip->offset;
+	NEXT();
+
+op_alter_addonly:
+	tape.cells[tape.pos] += ip->amount;
+	NEXT();
+
+op_add_at:
+	tape.cells[TAPE_INDEX(tape.pos, ip->offset)] += ip->amount;
+	NEXT();
+
+op_move_multiply:
+	tape.pos += ip->offset;
+	// Fallthrough
+
+op_multiply: {
+	cell_int orig = tape.cells[tape.pos];
+	size_t terms = ip->terms;
+	if (orig != 0) {
+		for (size_t i = 1; i <= terms; i++)
+			tape.cells[TAPE_INDEX(tape.pos, ip[i].offset)] += orig * ip[i].amount;
+	}
+	// The SET which always follows the terms
+	ip += terms + 1;
+	goto op_set;
+}
+
+op_set:
+	tape.cells[tape.pos] = ip->amount;
+	NEXT();
+
+op_set_at:
+	tape.cells[TAPE_INDEX(tape.pos, ip->offset)] = ip->amount;
+	NEXT();
+
+op_divide:
+	// The multiplier is in amount, and the shift in offset
+	if (!divide_cell(&tape.cells[tape.pos], ip->amount, ip->offset))
+		io_hang(io);
+	NEXT();
+
+op_product:
+	tape.cells[TAPE_INDEX(tape.pos, ip->offset)] += multiply_cells(tape.cells[tape.pos], tape.cells[TAPE_INDEX(tape.pos, ip[1].offset)], ip->amount);
+	ip++;
+	NEXT();
+
+op_set_multi:
+	for (ssize_t i = 0; i <= ip->offset; i++)
+		tape.cells[TAPE_INDEX(tape.pos, i)] = ip->amount;
+	NEXT();
+
+op_in: {
+	int input = input_byte(io);
+	if (input == EOF && sizeof(cell_int) == 1) input = 0;
+	tape.cells[tape.pos] = input;
+	NEXT();
+}
+
+op_out:
+	output_byte(&io->out, tape.cells[tape.pos]);
+	NEXT();
+
+op_in_at: {
+	int input = input_byte(io);
+	if (input == EOF && sizeof(cell_int) == 1) input = 0;
+	tape.cells[TAPE_INDEX(tape.pos, ip->offset)] = input;
+	NEXT();
+}
+
+op_out_at:
+	output_byte(&io->out, tape.cells[TAPE_INDEX(tape.pos, ip->offset)]);
+	NEXT();
+
+op_write_const:
+	output_bytes(&io->out, ip->text, ip->offset);
+	NEXT();
+
+op_skip: {
+	ssize_t offset = ip->offset;
+	tape_skip(&tape, offset);
+	NEXT();
+}
+
+op_clear_run:
+	tape_clear_run(&tape, ip->offset);
+	NEXT();
+
+op_shift_run:
+	tape_shift_run(&tape, ip->offset, ip->distance);
+	NEXT();
+
+op_jumpifzero:
+	if (tape.cells[tape.pos] == 0) {
+		ip = ip->target;
+		DISPATCH();
+	}
+	NEXT();
+
+op_jumpifnonzero:
+	if (tape.cells[tape.pos] != 0) {
+		ip = ip->target;
+		DISPATCH();
+	}
+	NEXT();
+
+op_move_jumpifnonzero:
+	tape.pos += ip->offset;
+	if (tape.cells[tape.pos] != 0) {
+		ip = ip->target;
+		DISPATCH();
+	}
+	NEXT();
+
+op_die:
+	output_flush(&io->out);
+	tape_free(&tape);
+	free(program);
+
+#undef NEXT
+#undef DISPATCH
+}
+
+#pragma GCC diagnostic pop
+
+#else // !defined __GNUC__
+
+void execute_bf_threaded(char *restrict bytecode, interpreter_meta meta, bf_io *io) {
+	// No computed goto available, so fall back to the switch-based engine
+	execute_bf(bytecode, meta, io);
+}
+
+#endif
@@ -0,0 +1,147 @@
+#define _DEFAULT_SOURCE  // For writev and madvise
+
+#include <errno.h>
+#include <string.h>
+#include <unistd.h>
+#include <err.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+
+#include "io.h"
+
+/*
+ * Maps the rest of the input in if it is a regular file, so that it never
+ * needs to be copied anywhere.
+ */
+static bool input_map(bf_input *in) {
+	struct stat st;
+	if (fstat(in->fd, &st) || !S_ISREG(st.st_mode))
+		return false;
+
+	// Something (e.g. the program source) may already have been read from it
+	off_t offset = lseek(in->fd, 0, SEEK_CUR);
+	if (offset < 0 || offset >= st.st_size)
+		return false;
+
+	void *mapping = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, in->fd, 0);
+	if (mapping == MAP_FAILED)
+		return false;
+	madvise(mapping, st.st_size, MADV_SEQUENTIAL);
+
+	in->buffer = mapping;
+	in->pos = offset;
+	in->len = st.st_size;
+	in->mapped = true;
+	return true;
+}
+
+void io_init(bf_io *io, int in_fd, int out_fd, enum output_buffering buffering) {
+	*io = (bf_io) {
+		.out = {
+			.buffer = malloc(OUTPUT_BUFFER_SIZE),
+			.fd = out_fd,
+			.buffering = buffering,
+			.line_buffered = buffering == BUFFER_LINE || (buffering == BUFFER_AUTO && isatty(out_fd)),
+		},
+		.in = {
+			.fd = in_fd,
+		},
+	};
+
+	if (!input_map(&io->in))
+		io->in.buffer = malloc(INPUT_BUFFER_SIZE);
+}
+
+void io_free(bf_io *io) {
+	output_flush(&io->out);
+	free(io->out.buffer);
+
+	if (io->in.mapped)
+		munmap(io->in.buffer, io->in.len);
+	else
+		free(io->in.buffer);
+}
+
+bool input_fill(bf_io *io) {
+	bf_input *in = &io->in;
+	if (in->mapped || in->eof)
+		return false;
+
+	output_flush(&io->out);  // Make sure any prompt has been seen before blocking
+
+	ssize_t got;
+	do {
+		got = read(in->fd, in->buffer, INPUT_BUFFER_SIZE);
+	} while (got < 0 && errno == EINTR);
+
+	if (got < 0)
+		err(1, "Can't read input");
+	if (got == 0) {
+		in->eof = true;
+		return false;
+	}
+
+	in->pos = 0;
+	in->len = got;
+	return true;
+}
+
+/*
+ * Writes out all of the given buffers, retrying on partial writes.
+ */
+static void write_all(int fd, struct iovec *iov, int count) {
+	while (count > 0) {
+		ssize_t written = writev(fd, iov, count);
+		if (written < 0) {
+			if (errno == EINTR)
+				continue;
+			err(1, "Can't write output");
+		}
+
+		while (count > 0 && (size_t)written >= iov->iov_len) {
+			written -= iov->iov_len;
+			iov++;
+			count--;
+		}
+		if (count > 0) {
+			iov->iov_base = (char*)iov->iov_base + written;
+			iov->iov_len -= written;
+		}
+	}
+}
+
+void output_flush(bf_output *out) {
+	if (out->pos == 0)
+		return;
+
+	struct iovec iov = {.iov_base = out->buffer, .iov_len = out->pos};
+	write_all(out->fd, &iov, 1);
+	out->pos = 0;
+}
+
+void output_bytes(bf_output *out, char const *data, size_t len) {
+	if (out->pos + len < OUTPUT_BUFFER_SIZE && !(out->line_buffered && memchr(data, '\n', len))) {
+		memcpy(out->buffer + out->pos, data, len);
+		out->pos += len;
+		return;
+	}
+
+	// Too big to buffer, or needs to go out now anyway: send both at once
+	struct iovec iov[2] = {
+		{.iov_base = out->buffer, .iov_len = out->pos},
+		{.iov_base = (char*)data, .iov_len = len},
+	};
+	write_all(out->fd, iov, 2);
+	out->pos = 0;
+}
+
+/*
+ * For a program which has got stuck in a loop that will never stop: there's
+ * nothing left for it to do but wait, so do that without spinning.
+ */
+_Noreturn void io_hang(bf_io *io) {
+	output_flush(&io->out);
+	for (;;)
+		pause();
+}
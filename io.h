@@ -0,0 +1,69 @@
+#ifndef USING_IO_H
+#define USING_IO_H
+
+/*
+ * Buffered I/O for running brainfuck programs.  Output is collected in a
+ * large buffer and written out with as few system calls as possible.  Input
+ * is read in large blocks, or mapped straight into memory when it comes from
+ * a regular file.
+ */
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define OUTPUT_BUFFER_SIZE 65536
+#define INPUT_BUFFER_SIZE 65536
+
+enum output_buffering {
+	BUFFER_AUTO,  // Line-buffered if writing to a terminal, fully-buffered otherwise
+	BUFFER_LINE,
+	BUFFER_FULL,
+};
+
+typedef struct {
+	char *buffer;
+	size_t pos;
+	int fd;
+	enum output_buffering buffering;  // As requested
+	bool line_buffered;  // Flush at every newline rather than only when full
+} bf_output;
+
+typedef struct {
+	char *buffer;  // Either our own buffer or the mapped file
+	size_t pos, len;
+	int fd;
+	bool mapped;
+	bool eof;  // Stays at EOF once it has been reached, like stdio
+} bf_input;
+
+typedef struct {
+	bf_output out;
+	bf_input in;
+} bf_io;
+
+void io_init(bf_io *io, int in_fd, int out_fd, enum output_buffering buffering);
+void io_free(bf_io *io);
+
+bool input_fill(bf_io *io);
+_Noreturn void io_hang(bf_io *io);
+
+void output_flush(bf_output *out);
+void output_bytes(bf_output *out, char const *data, size_t len);
+
+inline static void output_byte(bf_output *out, char c) {
+	out->buffer[out->pos++] = c;
+	if (out->pos == OUTPUT_BUFFER_SIZE || (out->line_buffered && c == '\n'))
+		output_flush(out);
+}
+
+/*
+ * Reads one byte of input, returning EOF at the end of it.
+ */
+inline static int input_byte(bf_io *io) {
+	bf_input *in = &io->in;
+	if (in->pos == in->len && !input_fill(io))
+		return EOF;
+	return (unsigned char)in->buffer[in->pos++];
+}
+
+#endif
@@ -0,0 +1,710 @@
+/*
+ * x86-64 native code generator.
+ *
+ * Translates flattened bytecode into machine code in an executable mapping
+ * and runs it directly.  While the generated code runs, rbx holds a pointer to
+ * the current cell and rbp points at a jit_state describing the tape.
+ */
+#define _DEFAULT_SOURCE  // For MAP_ANONYMOUS
+
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <stddef.h>
+#include <err.h>
+
+#include "assert2.h"
+#include "interpreter.h"
+#include "brainfuck.h"
+#include "flattener.h"
+#include "tape.h"
+#include "jit.h"
+
+#if JIT_AVAILABLE
+
+#include <sys/mman.h>
+
+typedef struct {
+	cell_int *lower_limit;  // Bounds checks reaching below this must grow the tape
+	cell_int *upper_limit;  // Bounds checks reaching this or above must grow the tape
+	tape_struct *tape;
+	interpreter_meta *meta;
+	bf_io *io;
+} jit_state;
+
+typedef cell_int* (*jit_function)(jit_state *state, cell_int *cell);
+
+enum jit_section {
+	JIT_HOT,
+	JIT_COLD,
+	JIT_BYTECODE,  // Only valid as a target: an address in the original bytecode
+};
+
+typedef struct {
+	size_t at;  // Position of a rel32 to fill in
+	size_t target;
+	enum jit_section at_section, target_section;
+} jit_fixup;
+
+typedef struct {
+	blob_cursor hot, cold;
+	jit_fixup *fixups;
+	size_t fixup_count, fixup_alloc;
+	interpreter_meta *meta;
+} jit_compiler;
+
+enum {
+	REG_AX = 0,
+	REG_CX = 1,
+	REG_DX = 2,
+	REG_BX = 3,
+	REG_BP = 5,
+	REG_SI = 6,
+	REG_DI = 7,
+};
+
+static void update_limits(jit_state *state) {
+	tape_struct *tape = state->tape;
+	state->lower_limit = tape->cells;
+	state->upper_limit = tape->cells + tape->back_size + tape->front_size;
+}
+
+static cell_int* jit_ensure_space(jit_state *state, cell_int *cell, ssize_t offset) {
+	tape_struct *tape = state->tape;
+	tape->pos = cell - tape->cells;
+	tape_ensure_space(tape, tape->pos + offset, state->meta);
+	update_limits(state);
+	return tape->cells + tape->pos;
+}
+
+static cell_int* jit_skip(jit_state *state, cell_int *cell, ssize_t stride) {
+	tape_struct *tape = state->tape;
+	return tape->cells + skip_scan(tape->cells, cell - tape->cells, stride, tape_extent(tape));
+}
+
+static cell_int* jit_clear_run(jit_state *state, cell_int *cell, ssize_t stride) {
+	tape_struct *tape = state->tape;
+	tape->pos = cell - tape->cells;
+	tape_clear_run(tape, stride);
+	return tape->cells + tape->pos;
+}
+
+static cell_int* jit_shift_run(jit_state *state, cell_int *cell, ssize_t stride, ssize_t distance) {
+	tape_struct *tape = state->tape;
+	tape->pos = cell - tape->cells;
+	tape_shift_run(tape, stride, distance);
+	return tape->cells + tape->pos;
+}
+
+static void jit_in(jit_state *state, cell_int *cell) {
+	int input = input_byte(state->io);
+	if (input == EOF && sizeof(cell_int) == 1) input = 0;
+	*cell = input;
+}
+
+static void jit_out(jit_state *state, cell_int *cell) {
+	output_byte(&state->io->out, *cell);
+}
+
+static void jit_write_const(jit_state *state, char const *text, size_t length) {
+	output_bytes(&state->io->out, text, length);
+}
+
+static void jit_divide(jit_state *state, cell_int *cell, cell_int multiplier, unsigned shift) {
+	if (!divide_cell(cell, multiplier, shift))
+		io_hang(state->io);
+}
+
+static void emit_byte(blob_cursor *code, unsigned char byte) {
+	if (code->pos == code->len) {
+		code->len *= 2;
+		code->data = realloc(code->data, code->len);
+	}
+	code->data[code->pos++] = byte;
+}
+
+static void emit_int(blob_cursor *code, int64_t value, size_t size) {
+	for (size_t i = 0; i < size; i++)
+		emit_byte(code, (unsigned char)((uint64_t)value >> (8 * i)));
+}
+
+static void emit_bytes(blob_cursor *code, size_t count, ...) {
+	va_list args;
+	va_start(args, count);
+	for (size_t i = 0; i < count; i++)
+		emit_byte(code, (unsigned char)va_arg(args, int));
+	va_end(args);
+}
+
+static bool fits_int8(int64_t value) {
+	return value == (int8_t)value;
+}
+
+static bool fits_int32(int64_t value) {
+	return value == (int32_t)value;
+}
+
+static int32_t checked_displacement(ssize_t cells) {
+	int64_t bytes = (int64_t)cells * (int64_t)sizeof(cell_int);
+	if (!fits_int32(bytes))
+		errx(1, "Offset %zd is too large to compile", cells);
+	return (int32_t)bytes;
+}
+
+static void add_fixup(jit_compiler *jit, enum jit_section at_section, size_t target, enum jit_section target_section) {
+	if (jit->fixup_count == jit->fixup_alloc) {
+		jit->fixup_alloc *= 2;
+		jit->fixups = realloc(jit->fixups, jit->fixup_alloc * sizeof *jit->fixups);
+	}
+	blob_cursor *code = at_section == JIT_HOT ? &jit->hot : &jit->cold;
+	jit->fixups[jit->fixup_count++] = (jit_fixup) {
+		.at = code->pos,
+		.target = target,
+		.at_section = at_section,
+		.target_section = target_section,
+	};
+	emit_int(code, 0, 4);
+}
+
+/*
+ * Emits the ModRM byte (and displacement) for an operand of the form
+ * [rbx + offset cells], with the given register or opcode extension.
+ */
+static void emit_cell_operand(blob_cursor *code, int reg, ssize_t offset) {
+	int32_t disp = checked_displacement(offset);
+	if (disp == 0) {
+		emit_byte(code, (unsigned char)(reg << 3 | REG_BX));
+	} else if (fits_int8(disp)) {
+		emit_byte(code, (unsigned char)(0x40 | reg << 3 | REG_BX));
+		emit_int(code, disp, 1);
+	} else {
+		emit_byte(code, (unsigned char)(0x80 | reg << 3 | REG_BX));
+		emit_int(code, disp, 4);
+	}
+}
+
+// Operand-size prefix for cell-sized operations
+static void emit_cell_prefix(blob_cursor *code) {
+	if (sizeof(cell_int) == 2)
+		emit_byte(code, 0x66);
+	else if (sizeof(cell_int) == 8)
+		emit_byte(code, 0x48);
+}
+
+/*
+ * Emits "op [rbx + offset], reg" for a cell-sized register, where op8 is the
+ * opcode of the byte-sized version of the instruction.
+ */
+static void emit_cell_reg_op(blob_cursor *code, unsigned char op8, int reg, ssize_t offset) {
+	emit_cell_prefix(code);
+	emit_byte(code, sizeof(cell_int) == 1 ? op8 : op8 + 1);
+	emit_cell_operand(code, reg, offset);
+}
+
+// Loads a (possibly 64-bit) constant into the given register
+static void emit_mov_imm(blob_cursor *code, int reg, int64_t value) {
+	emit_byte(code, 0x48);
+	emit_byte(code, (unsigned char)(0xB8 + reg));
+	emit_int(code, value, 8);
+}
+
+/*
+ * Emits "op [rbx + offset], amount" for a cell-sized immediate, where op8 and
+ * ext are the byte-sized opcode and its ModRM extension, and reg_op8 is the
+ * equivalent instruction taking a register (for 64-bit amounts which don't fit
+ * in an immediate).
+ */
+static void emit_cell_imm_op(blob_cursor *code, unsigned char op8, int ext, unsigned char reg_op8, ssize_t offset, cell_int amount) {
+	if (sizeof(cell_int) == 8 && !fits_int32((int64_t)amount)) {
+		emit_mov_imm(code, REG_AX, (int64_t)amount);
+		emit_cell_reg_op(code, reg_op8, REG_AX, offset);
+		return;
+	}
+
+	emit_cell_prefix(code);
+	emit_byte(code, sizeof(cell_int) == 1 ? op8 : op8 + 1);
+	emit_cell_operand(code, ext, offset);
+	emit_int(code, (int64_t)amount, sizeof(cell_int) > 4 ? 4 : sizeof(cell_int));
+}
+
+static void emit_cell_add(blob_cursor *code, ssize_t offset, cell_int amount) {
+	emit_cell_imm_op(code, 0x80, 0, 0x00, offset, amount);
+}
+
+static void emit_cell_set(blob_cursor *code, ssize_t offset, cell_int amount) {
+	emit_cell_imm_op(code, 0xC6, 0, 0x88, offset, amount);
+}
+
+static void emit_cell_test(blob_cursor *code) {
+	emit_cell_imm_op(code, 0x80, 7, 0x38, 0, 0);
+}
+
+static void emit_move(blob_cursor *code, ssize_t offset) {
+	int32_t disp = checked_displacement(offset);
+	emit_byte(code, 0x48);
+	if (fits_int8(disp)) {
+		emit_byte(code, 0x83);  // add rbx, imm8
+		emit_byte(code, 0xC0 | REG_BX);
+		emit_int(code, disp, 1);
+	} else {
+		emit_byte(code, 0x81);  // add rbx, imm32
+		emit_byte(code, 0xC0 | REG_BX);
+		emit_int(code, disp, 4);
+	}
+}
+
+static void emit_call(blob_cursor *code, void (*function)(void)) {
+	emit_mov_imm(code, REG_AX, (int64_t)(intptr_t)function);
+	emit_byte(code, 0xFF);  // call rax
+	emit_byte(code, 0xD0);
+}
+
+static void emit_io_call(blob_cursor *code, void (*function)(jit_state *, cell_int *), ssize_t offset) {
+	emit_bytes(code, 3, 0x48, 0x89, 0xEF);  // mov rdi, rbp
+	if (offset) {
+		emit_bytes(code, 2, 0x48, 0x8D);  // lea rsi, [rbx + offset]
+		emit_cell_operand(code, REG_SI, offset);
+	} else {
+		emit_bytes(code, 3, 0x48, 0x89, 0xDE);  // mov rsi, rbx
+	}
+	emit_call(code, (void (*)(void))function);
+}
+
+// Loads a cell into (e/r)ax or (e/r)cx, zero-extended for narrow cells
+static void emit_cell_load(blob_cursor *code, int reg, ssize_t offset) {
+	switch (sizeof(cell_int)) {
+		case 1: emit_bytes(code, 2, 0x0F, 0xB6); break;  // movzx reg, byte [rbx + offset]
+		case 2: emit_bytes(code, 2, 0x0F, 0xB7); break;  // movzx reg, word [rbx + offset]
+		case 4: emit_byte(code, 0x8B); break;  // mov reg, [rbx + offset]
+		case 8: emit_bytes(code, 2, 0x48, 0x8B); break;  // mov reg, [rbx + offset]
+	}
+	emit_cell_operand(code, reg, offset);
+}
+
+// Adds (e/r)ax times the amount to the cell at the offset, clobbering (e/r)cx
+static void emit_multiply_term(blob_cursor *code, ssize_t offset, cell_int amount) {
+	if (amount == 1) {
+		emit_cell_reg_op(code, 0x00, REG_AX, offset);  // add [rbx + offset], ax
+	} else if (amount == (cell_int)-1) {
+		emit_cell_reg_op(code, 0x28, REG_AX, offset);  // sub [rbx + offset], ax
+	} else {
+		if (sizeof(cell_int) == 8 && !fits_int32((int64_t)amount)) {
+			emit_mov_imm(code, REG_CX, (int64_t)amount);
+			emit_bytes(code, 4, 0x48, 0x0F, 0xAF, 0xC8);  // imul rcx, rax
+		} else {
+			if (sizeof(cell_int) == 8)
+				emit_byte(code, 0x48);
+			emit_bytes(code, 2, 0x69, 0xC8);  // imul ecx, eax, imm32
+			emit_int(code, (int64_t)amount, 4);
+		}
+		emit_cell_reg_op(code, 0x00, REG_CX, offset);  // add [rbx + offset], cx
+	}
+}
+
+static void compile_multiply(blob_cursor *code, char *what, char opcode) {
+	uint8_t repeat = *(uint8_t*)what;
+	what++;
+
+	emit_cell_load(code, REG_AX, 0);
+	do {
+		ssize_t offset = read_offset_operand(&what, opcode);
+		cell_int amount = *(cell_int*)what;
+		what += sizeof(cell_int);
+
+		emit_multiply_term(code, offset, amount);
+	} while (repeat--);
+}
+
+static void compile_product(blob_cursor *code, char *what, char opcode) {
+	ssize_t offset = read_offset_operand(&what, opcode);
+	ssize_t factor = read_offset_operand(&what, opcode);
+	cell_int amount = *(cell_int*)what;
+
+	emit_cell_load(code, REG_AX, 0);
+	emit_cell_load(code, REG_CX, factor);
+	if (sizeof(cell_int) == 8)
+		emit_byte(code, 0x48);
+	emit_bytes(code, 3, 0x0F, 0xAF, 0xC1);  // imul eax, ecx
+	emit_multiply_term(code, offset, amount);
+}
+
+static void compile_set_multi(blob_cursor *code, ssize_t offset, cell_int amount) {
+	if (offset < 8) {
+		for (ssize_t i = 0; i <= offset; i++)
+			emit_cell_set(code, i, amount);
+		return;
+	}
+
+	emit_bytes(code, 3, 0x48, 0x89, 0xDF);  // mov rdi, rbx
+	emit_mov_imm(code, REG_CX, offset + 1);
+	emit_mov_imm(code, REG_AX, (int64_t)amount);
+	emit_byte(code, 0xF3);  // rep
+	switch (sizeof(cell_int)) {
+		case 1: emit_byte(code, 0xAA); break;  // stosb
+		case 2: emit_bytes(code, 2, 0x66, 0xAB); break;  // stosw
+		case 4: emit_byte(code, 0xAB); break;  // stosd
+		case 8: emit_bytes(code, 2, 0x48, 0xAB); break;  // stosq
+	}
+}
+
+static void compile_skip(blob_cursor *code, ssize_t offset) {
+	// Try a couple of steps inline, then hand longer scans to the vector kernels
+	size_t short_exits[3], exit_count = 0;
+	if (offset >= -SKIP_MAX_VECTOR_STRIDE && offset <= SKIP_MAX_VECTOR_STRIDE) {
+		for (int i = 0; i < 3; i++) {
+			if (i > 0)
+				emit_move(code, offset);
+			emit_cell_test(code);
+			emit_bytes(code, 2, 0x74, 0);  // je done
+			short_exits[exit_count++] = code->pos;
+		}
+
+		emit_bytes(code, 3, 0x48, 0x89, 0xEF);  // mov rdi, rbp
+		emit_bytes(code, 3, 0x48, 0x89, 0xDE);  // mov rsi, rbx
+		emit_mov_imm(code, REG_DX, offset);
+		emit_call(code, (void (*)(void))jit_skip);
+		emit_bytes(code, 3, 0x48, 0x89, 0xC3);  // mov rbx, rax
+	}
+
+	// Then finish off one cell at a time.  Measure the move so we can jump over it
+	blob_cursor move = {.data = malloc(16), .pos = 0, .len = 16};
+	emit_move(&move, offset);
+
+	emit_bytes(code, 2, 0xEB, (int)move.pos);  // jmp check
+	size_t loop_start = code->pos;
+	for (size_t i = 0; i < move.pos; i++)
+		emit_byte(code, (unsigned char)move.data[i]);
+	free(move.data);
+
+	// check:
+	emit_cell_test(code);
+	ssize_t back = (ssize_t)loop_start - (ssize_t)(code->pos + 2);
+	if (fits_int8(back)) {
+		emit_bytes(code, 2, 0x75, (int)back);  // jne loop
+	} else {
+		back -= 4;
+		emit_bytes(code, 2, 0x0F, 0x85);  // jne loop
+		emit_int(code, back, 4);
+	}
+
+	// done:
+	for (size_t i = 0; i < exit_count; i++) {
+		size_t distance = code->pos - short_exits[i];
+		assert(fits_int8((int64_t)distance));
+		code->data[short_exits[i] - 1] = (char)distance;
+	}
+}
+
+static void compile_bounds_check(jit_compiler *jit, ssize_t offset) {
+	blob_cursor *code = &jit->hot, *cold = &jit->cold;
+	interpreter_meta *meta = jit->meta;
+
+	// lea rax, [rbx + furthest point a skip could take us]
+	ssize_t reach = offset + (offset < 0 ? meta->lowest_negative_skip : meta->highest_positive_skip);
+	emit_bytes(code, 3, 0x48, 0x8D, 0x80 | REG_AX << 3 | REG_BX);
+	emit_int(code, checked_displacement(reach), 4);
+
+	// cmp rax, [rbp + limit]
+	size_t limit = offset < 0 ? offsetof(jit_state, lower_limit) : offsetof(jit_state, upper_limit);
+	emit_bytes(code, 4, 0x48, 0x3B, 0x40 | REG_AX << 3 | REG_BP, (int)limit);
+
+	// jb/jae to the cold path
+	emit_bytes(code, 2, 0x0F, offset < 0 ? 0x82 : 0x83);
+	add_fixup(jit, JIT_HOT, cold->pos, JIT_COLD);
+	size_t resume = code->pos;
+
+	emit_bytes(cold, 3, 0x48, 0x89, 0xEF);  // mov rdi, rbp
+	emit_bytes(cold, 3, 0x48, 0x89, 0xDE);  // mov rsi, rbx
+	emit_mov_imm(cold, REG_DX, offset);
+	emit_call(cold, (void (*)(void))jit_ensure_space);
+	emit_bytes(cold, 3, 0x48, 0x89, 0xC3);  // mov rbx, rax
+	emit_byte(cold, 0xE9);  // jmp resume
+	add_fixup(jit, JIT_COLD, resume, JIT_HOT);
+}
+
+static void emit_epilogue(blob_cursor *code) {
+	emit_bytes(code, 3, 0x48, 0x89, 0xD8);  // mov rax, rbx
+	emit_bytes(code, 4, 0x48, 0x83, 0xC4, 0x08);  // add rsp, 8
+	emit_byte(code, 0x5D);  // pop rbp
+	emit_byte(code, 0x5B);  // pop rbx
+	emit_byte(code, 0xC3);  // ret
+}
+
+/*
+ * Compiles the bytecode between start and end into a function which returns
+ * when execution reaches either a DIE or the end of the range.  Any jumps in
+ * the range must land inside it.
+ */
+static void compile_bf(jit_compiler *jit, char *restrict bytecode, size_t start, size_t end, size_t *restrict native_address) {
+	blob_cursor *code = &jit->hot;
+
+	// Prologue: keep the stack aligned for calls out to C
+	emit_byte(code, 0x53);  // push rbx
+	emit_byte(code, 0x55);  // push rbp
+	emit_bytes(code, 4, 0x48, 0x83, 0xEC, 0x08);  // sub rsp, 8
+	emit_bytes(code, 3, 0x48, 0x89, 0xFD);  // mov rbp, rdi
+	emit_bytes(code, 3, 0x48, 0x89, 0xF3);  // mov rbx, rsi
+
+	for (size_t address = start; address < end; address += bytecode_op_size(&bytecode[address])) {
+		native_address[address - start] = code->pos;
+		char opcode = bytecode[address];
+		char *what = &bytecode[address + 1];
+		switch (BYTECODE_OP(opcode)) {
+			case BF_OP_ALTER: {
+				ssize_t offset = read_offset_operand(&what, opcode);
+				cell_int amount = *(cell_int*)what;
+				emit_move(code, offset);
+				emit_cell_add(code, 0, amount);
+				break;
+			}
+
+			case BF_OP_BOUNDS_CHECK:
+				compile_bounds_check(jit, read_offset_operand(&what, opcode));
+				break;
+
+			case BF_OP_ALTER_MOVEONLY:
+				emit_move(code, read_offset_operand(&what, opcode));
+				break;
+
+			case BF_OP_ALTER_ADDONLY:
+				emit_cell_add(code, 0, *(cell_int*)what);
+				break;
+
+			case BF_OP_ADD_AT: {
+				ssize_t offset = read_offset_operand(&what, opcode);
+				emit_cell_add(code, offset, *(cell_int*)what);
+				break;
+			}
+
+			case BF_OP_MOVE_MULTIPLY:
+				emit_move(code, read_offset_operand(&what, opcode));
+				// Fallthrough
+
+			case BF_OP_MULTIPLY: {
+				compile_multiply(code, what, opcode);
+				// Followed by the amount to set the current cell to
+				size_t size = bytecode_op_size(&bytecode[address]);
+				emit_cell_set(code, 0, *(cell_int*)&bytecode[address + size - sizeof(cell_int)]);
+				break;
+			}
+
+			case BF_OP_SET:
+				emit_cell_set(code, 0, *(cell_int*)what);
+				break;
+
+			case BF_OP_SET_AT: {
+				ssize_t offset = read_offset_operand(&what, opcode);
+				emit_cell_set(code, offset, *(cell_int*)what);
+				break;
+			}
+
+			case BF_OP_PRODUCT:
+				compile_product(code, what, opcode);
+				break;
+
+			case BF_OP_DIVIDE:
+				// Rare enough to leave to C
+				emit_bytes(code, 3, 0x48, 0x89, 0xEF);  // mov rdi, rbp
+				emit_bytes(code, 3, 0x48, 0x89, 0xDE);  // mov rsi, rbx
+				emit_mov_imm(code, REG_DX, *(cell_int*)what);
+				emit_mov_imm(code, REG_CX, *(uint8_t*)(what + sizeof(cell_int)));
+				emit_call(code, (void (*)(void))jit_divide);
+				break;
+
+			case BF_OP_SET_MULTI: {
+				ssize_t offset = read_offset_operand(&what, opcode);
+				cell_int amount = *(cell_int*)what;
+				compile_set_multi(code, offset, amount);
+				break;
+			}
+
+			case BF_OP_IN:
+				emit_io_call(code, jit_in, 0);
+				break;
+
+			case BF_OP_OUT:
+				emit_io_call(code, jit_out, 0);
+				break;
+
+			case BF_OP_IN_AT:
+				emit_io_call(code, jit_in, read_offset_operand(&what, opcode));
+				break;
+
+			case BF_OP_OUT_AT:
+				emit_io_call(code, jit_out, read_offset_operand(&what, opcode));
+				break;
+
+			case BF_OP_WRITE_CONST: {
+				// The text stays in the bytecode, which outlives the code
+				ssize_t length = read_offset_operand(&what, opcode);
+				emit_bytes(code, 3, 0x48, 0x89, 0xEF);  // mov rdi, rbp
+				emit_mov_imm(code, REG_SI, (int64_t)(intptr_t)what);
+				emit_mov_imm(code, REG_DX, length);
+				emit_call(code, (void (*)(void))jit_write_const);
+				break;
+			}
+
+			case BF_OP_SKIP:
+				compile_skip(code, read_offset_operand(&what, opcode));
+				break;
+
+			case BF_OP_CLEAR_RUN:
+				// Left to the same kernels as the interpreters use
+				emit_bytes(code, 3, 0x48, 0x89, 0xEF);  // mov rdi, rbp
+				emit_bytes(code, 3, 0x48, 0x89, 0xDE);  // mov rsi, rbx
+				emit_mov_imm(code, REG_DX, read_offset_operand(&what, opcode));
+				emit_call(code, (void (*)(void))jit_clear_run);
+				emit_bytes(code, 3, 0x48, 0x89, 0xC3);  // mov rbx, rax
+				break;
+
+			case BF_OP_SHIFT_RUN:
+				emit_bytes(code, 3, 0x48, 0x89, 0xEF);  // mov rdi, rbp
+				emit_bytes(code, 3, 0x48, 0x89, 0xDE);  // mov rsi, rbx
+				emit_mov_imm(code, REG_DX, read_offset_operand(&what, opcode));
+				emit_mov_imm(code, REG_CX, read_offset_operand(&what, opcode));
+				emit_call(code, (void (*)(void))jit_shift_run);
+				emit_bytes(code, 3, 0x48, 0x89, 0xC3);  // mov rbx, rax
+				break;
+
+			case BF_OP_MOVE_JUMPIFNONZERO:
+			case BF_OP_MOVE_NATIVE_LOOP:
+				emit_move(code, read_offset_operand(&what, opcode));
+				// Fallthrough
+
+			case BF_OP_JUMPIFZERO:
+			case BF_OP_JUMPIFNONZERO:
+			case BF_OP_NATIVE_LOOP: {
+				size_t target = address + bytecode_op_size(&bytecode[address]) + read_jump_operand(&what);
+				assert(target >= start && target <= end);
+				emit_cell_test(code);
+				emit_bytes(code, 2, 0x0F, opcode == BF_OP_JUMPIFZERO ? 0x84 : 0x85);  // je/jne
+				add_fixup(jit, JIT_HOT, target - start, JIT_BYTECODE);
+				break;
+			}
+
+			case BF_OP_DIE:
+				emit_epilogue(code);
+				break;
+
+			default:
+				assert(!"Compiling an invalid opcode");
+		}
+	}
+
+	native_address[end - start] = code->pos;
+	emit_epilogue(code);
+}
+
+/*
+ * Lays out the hot and cold code one after another in executable memory,
+ * resolving all jumps between them.
+ */
+static void *link_bf(jit_compiler *jit, size_t *restrict native_address, size_t *restrict size) {
+	size_t cold_base = jit->hot.pos;
+	*size = jit->hot.pos + jit->cold.pos;
+
+	unsigned char *image = malloc(*size);
+	memcpy(image, jit->hot.data, jit->hot.pos);
+	memcpy(image + cold_base, jit->cold.data, jit->cold.pos);
+
+	for (size_t i = 0; i < jit->fixup_count; i++) {
+		jit_fixup *fixup = &jit->fixups[i];
+		size_t at = fixup->at + (fixup->at_section == JIT_COLD ? cold_base : 0);
+		size_t target = fixup->target;
+		if (fixup->target_section == JIT_COLD)
+			target += cold_base;
+		else if (fixup->target_section == JIT_BYTECODE)  // Relative to the start of the compiled range
+			target = native_address[target];
+
+		int32_t rel = (int32_t)((ssize_t)target - (ssize_t)(at + 4));
+		memcpy(image + at, &rel, sizeof rel);
+	}
+
+	void *memory = mmap(NULL, *size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (memory == MAP_FAILED)
+		err(1, "Can't allocate memory for compiled code");
+	memcpy(memory, image, *size);
+	free(image);
+	if (mprotect(memory, *size, PROT_READ | PROT_EXEC) != 0)
+		err(1, "Can't make compiled code executable");
+	return memory;
+}
+
+bool jit_compile(char *restrict bytecode, size_t start, size_t end, interpreter_meta *meta, jit_code *out) {
+	size_t *native_address = malloc((end - start + 1) * sizeof *native_address);
+
+	jit_compiler jit = {
+		.hot = {.data = malloc(4096), .pos = 0, .len = 4096},
+		.cold = {.data = malloc(1024), .pos = 0, .len = 1024},
+		.fixups = malloc(64 * sizeof *jit.fixups),
+		.fixup_alloc = 64,
+		.meta = meta,
+	};
+	compile_bf(&jit, bytecode, start, end, native_address);
+
+	out->memory = link_bf(&jit, native_address, &out->size);
+	free(jit.hot.data);
+	free(jit.cold.data);
+	free(jit.fixups);
+	free(native_address);
+	return true;
+}
+
+void jit_run(jit_code *code, tape_struct *tape, interpreter_meta *meta, bf_io *io) {
+	jit_state state = {
+		.tape = tape,
+		.meta = meta,
+		.io = io,
+	};
+	update_limits(&state);
+
+	jit_function function;
+	*(void **)&function = code->memory;
+	cell_int *cell = function(&state, tape->cells + tape->pos);
+	tape->pos = cell - tape->cells;
+}
+
+void jit_free(jit_code *code) {
+	munmap(code->memory, code->size);
+}
+
+#else // No JIT for this platform/configuration
+
+bool jit_compile(char *restrict bytecode, size_t start, size_t end, interpreter_meta *meta, jit_code *out) {
+	// Callers should check JIT_AVAILABLE
+	(void)bytecode; (void)start; (void)end; (void)meta; (void)out;
+	return false;
+}
+
+void jit_run(jit_code *code, tape_struct *tape, interpreter_meta *meta, bf_io *io) {
+	(void)code; (void)tape; (void)meta; (void)io;
+	assert(!"Running code from an unavailable JIT");
+}
+
+void jit_free(jit_code *code) {
+	(void)code;
+}
+
+#endif
+
+void execute_bf_jit(char *restrict bytecode, interpreter_meta meta, bf_io *io) {
+	jit_code code;
+	if (!jit_compile(bytecode, 0, bytecode_length(bytecode), &meta, &code)) {
+#ifdef FIXED_TAPE_SIZE
+		warnx("JIT compilation is not supported with a fixed-size tape; interpreting instead.");
+#else
+		warnx("JIT compilation is only supported on x86-64; interpreting instead.");
+#endif
+		execute_bf(bytecode, meta, io);
+		return;
+	}
+
+	tape_struct tape;
+	tape_init(&tape, &meta);
+	jit_run(&code, &tape, &meta, io);
+	output_flush(&io->out);
+	jit_free(&code);
+	tape_free(&tape);
+}
@@ -0,0 +1,25 @@
+#ifndef USING_JIT_H
+#define USING_JIT_H
+
+#include <stdbool.h>
+#include <stdlib.h>
+
+#include "interpreter.h"
+#include "tape.h"
+
+#if defined(__x86_64__) && !defined(FIXED_TAPE_SIZE)
+#define JIT_AVAILABLE 1
+#else
+#define JIT_AVAILABLE 0
+#endif
+
+typedef struct {
+	void *memory;
+	size_t size;
+} jit_code;
+
+bool jit_compile(char *bytecode, size_t start, size_t end, interpreter_meta *meta, jit_code *out);
+void jit_run(jit_code *code, tape_struct *tape, interpreter_meta *meta, bf_io *io);
+void jit_free(jit_code *code);
+
+#endif
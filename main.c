@@ -1,13 +1,13 @@
 #include <stdbool.h>
 #include <stdint.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <err.h>
+#include <unistd.h>
 
-#include "parser.h"
-#include "flattener.h"
-#include "interpreter.h"
-#include "debug.h"
+#include "run.h"
+#include "bytecode_file.h"
 
 /*
  * Brainfuck basics:
@@ -23,6 +23,13 @@
  */
 
 void usage(char *my_name, FILE *send_help_to, int exitcode) {
+	char pass_names[256] = "";
+	for (enum bf_pass pass = 0; pass < PASS_COUNT; pass++) {
+		if (pass)
+			strcat(pass_names, ",");
+		strcat(pass_names, pass_name(pass));
+	}
+
 	fprintf(send_help_to,
 			"Optimizing brainfuck interpreter\n"
 			"\n"
@@ -35,15 +42,87 @@ void usage(char *my_name, FILE *send_help_to, int exitcode) {
 			"\t--dump-tree       Dump the optimized representation of the brainfuck program in tree form before execution\n"
 			"\t--dump-opcodes    Dump the flat optimized representation of the brainfuck program before execution\n"
 			"\t--no-execute      Do not execute the brainfuck program\n"
+			"\t--threaded        Execute using the direct-threaded engine instead of the bytecode switch\n"
+			"\t--jit             Compile the program to native code before executing it\n"
+			"\t--tiered          Interpret the program, compiling loops to native code once they become hot\n"
+			"\t--count-op-sequences\n"
+			"\t                  Interpret the program, then print to stderr how often each pair and triple of ops ran back to back\n"
+			"\t                  (see the profile-ops script)\n"
+			"\t--profile         Interpret the program, then print to stderr how often each kind of op ran and how much\n"
+			"\t                  time was spent in each loop, most expensive first\n"
+			"\t--annotate        As --profile, then print the source with how many ops ran for each line of it\n"
+			"\t--batch           Read the names of input files from stdin, one per line, and run the program against each of\n"
+			"\t                  them at once, writing each one's output to its name with " BATCH_OUTPUT_SUFFIX " on the end\n"
+			"\t--jobs=N          Number of threads to run a --batch on (default: one per processor)\n"
+			"\t--emit-bytecode=FILE\n"
+			"\t                  Save the compiled program to FILE, which can then be run in place of the source\n"
+			"\t--cache[=DIR]     Keep compiled programs in DIR (default: $XDG_CACHE_HOME/brainfuck or ~/.cache/brainfuck),\n"
+			"\t                  and run them from there when the same source is run again\n"
+			"\t--cell-bits=8|16|32|64\n"
+			"\t                  Width of each cell on the tape (default: 8)\n"
+			"\t--tape=realloc|vm|vm-huge|fixed-256|fixed-65536\n"
+			"\t                  Grow the tape with realloc behind bounds checks (default), or reserve a huge tape up front\n"
+			"\t                  in virtual memory and commit it as it gets used, dropping the bounds checks\n"
+			"\t                  (vm-huge also asks for transparent huge pages), or use a tape of a fixed number of cells\n"
+			"\t                  whose position wraps around at the ends\n"
+			"\t--eval-steps=N    Run up to N steps of the program while compiling it, until it first needs input, so that\n"
+			"\t                  only what's left has to be run (default: %d; 0 to not)\n"
+			"\t-O0|-O1|-O2|-O3   How hard to optimize the program: -O0 only does what's needed to run it, -O1 also turns\n"
+			"\t                  common loops into single ops, -O2 runs every pass once, and -O3 runs them again until\n"
+			"\t                  they stop changing anything (default: -O%d)\n"
+			"\t--passes=PASS,... Run exactly these optimization passes, in this order: %s\n"
+			"\t--disable-pass=PASS,...\n"
+			"\t                  Leave these passes out of the ones picked by -O or --passes\n"
+			"\t--time-passes     Print to stderr how long each pass took and how many ops it left in the program\n"
+			"\t--output-buffering=line|full\n"
+			"\t                  Flush output at every newline, or only when the output buffer is full or input is needed\n"
+			"\t                  (default: line-buffered when writing to a terminal)\n"
 			"\t--help            Print this help message\n"
 			"\t--                Stop parsing options. The next argument, if any, will be treated as the filename\n",
-			my_name
+			my_name, DEFAULT_EVAL_STEPS, DEFAULT_OPT_LEVEL, pass_names
 	);
 	exit(exitcode);
 }
 
+static struct {
+	int cell_bits;
+	enum tape_kind tape_kind;
+	run_function *run;
+} const variants[] = {
+#define VARIANT_ENTRY(bits, tape, kind) {bits, kind, run_program_cell##bits##_##tape},
+	FOR_EACH_VARIANT(VARIANT_ENTRY)
+#undef VARIANT_ENTRY
+};
+
+static run_function *find_variant(int cell_bits, enum tape_kind tape_kind) {
+	// The variants with a growing tape handle all of the kinds of tape which grow
+	if (tape_kind == TAPE_VM || tape_kind == TAPE_VM_HUGE)
+		tape_kind = TAPE_REALLOC;
+
+	for (size_t i = 0; i < sizeof variants / sizeof *variants; i++) {
+		if (variants[i].cell_bits == cell_bits && variants[i].tape_kind == tape_kind)
+			return variants[i].run;
+	}
+	return NULL;
+}
+
 int main(int argc, char **argv){
-	bool dump_tree = false, dump_opcodes = false, execute = true;
+	run_options options = {
+		.execute = true,
+		.buffering = BUFFER_AUTO,
+		.tape_kind = TAPE_REALLOC,
+		.eval_steps = DEFAULT_EVAL_STEPS,
+	};
+	int cell_bits = 8;
+	bool cell_bits_given = false, tape_given = false;
+	bool batching = false;
+	batch inputs = {0};
+	char const *cache_dir = NULL;
+	char *default_cache_dir = NULL;
+	// Taken out of whichever passes end up picked, once they all have been
+	char const **disabled_passes = malloc(argc * sizeof *disabled_passes);
+	size_t disabled_count = 0;
+	pipeline_preset(&options.pipeline, DEFAULT_OPT_LEVEL);
 
 	int argpos = 1;
 	for (; argpos < argc; argpos++) {
@@ -51,11 +130,91 @@ int main(int argc, char **argv){
 		if (argv[argpos][0] != '-') break;
 
 		if (!strcmp(argv[argpos], "--dump-opcodes")) {
-			dump_opcodes = true;
+			options.dump_opcodes = true;
 		} else if (!strcmp(argv[argpos], "--dump-tree")) {
-			dump_tree = true;
+			options.dump_tree = true;
 		} else if (!strcmp(argv[argpos], "--no-execute")) {
-			execute = false;
+			options.execute = false;
+		} else if (!strcmp(argv[argpos], "--threaded")) {
+			options.threaded = true;
+		} else if (!strcmp(argv[argpos], "--jit")) {
+			options.jit = true;
+		} else if (!strcmp(argv[argpos], "--tiered")) {
+			options.tiered = true;
+		} else if (!strcmp(argv[argpos], "--count-op-sequences")) {
+			options.count_sequences = true;
+		} else if (!strcmp(argv[argpos], "--profile")) {
+			options.profile = true;
+		} else if (!strcmp(argv[argpos], "--annotate")) {
+			options.profile = options.annotate = true;
+		} else if (!strcmp(argv[argpos], "--batch")) {
+			batching = true;
+		} else if (!strncmp(argv[argpos], "--jobs=", strlen("--jobs="))) {
+			int jobs = atoi(argv[argpos] + strlen("--jobs="));
+			if (jobs < 1) {
+				warnx("Invalid number of jobs %s", argv[argpos] + strlen("--jobs="));
+				usage(argv[0], stderr, 1);
+			}
+			inputs.jobs = jobs;
+		} else if (!strncmp(argv[argpos], "--emit-bytecode=", strlen("--emit-bytecode="))) {
+			options.emit_bytecode = argv[argpos] + strlen("--emit-bytecode=");
+		} else if (!strcmp(argv[argpos], "--cache")) {
+			if (!default_cache_dir)
+				default_cache_dir = cache_default_dir();
+			if (!default_cache_dir)
+				errx(1, "There's nowhere to put the cache: set XDG_CACHE_HOME or HOME, or use --cache=DIR");
+			cache_dir = default_cache_dir;
+		} else if (!strncmp(argv[argpos], "--cache=", strlen("--cache="))) {
+			cache_dir = argv[argpos] + strlen("--cache=");
+		} else if (!strcmp(argv[argpos], "--tape=realloc")) {
+			options.tape_kind = TAPE_REALLOC;
+			tape_given = true;
+		} else if (!strcmp(argv[argpos], "--tape=vm")) {
+			options.tape_kind = TAPE_VM;
+			tape_given = true;
+		} else if (!strcmp(argv[argpos], "--tape=vm-huge")) {
+			options.tape_kind = TAPE_VM_HUGE;
+			tape_given = true;
+		} else if (!strcmp(argv[argpos], "--tape=fixed-256")) {
+			options.tape_kind = TAPE_FIXED_256;
+			tape_given = true;
+		} else if (!strcmp(argv[argpos], "--tape=fixed-65536")) {
+			options.tape_kind = TAPE_FIXED_65536;
+			tape_given = true;
+		} else if (!strncmp(argv[argpos], "--cell-bits=", strlen("--cell-bits="))) {
+			cell_bits = atoi(argv[argpos] + strlen("--cell-bits="));
+			cell_bits_given = true;
+			if (!find_variant(cell_bits, TAPE_REALLOC)) {
+				warnx("Invalid cell width %s", argv[argpos] + strlen("--cell-bits="));
+				usage(argv[0], stderr, 1);
+			}
+		} else if (!strncmp(argv[argpos], "--eval-steps=", strlen("--eval-steps="))) {
+			char *steps = argv[argpos] + strlen("--eval-steps="), *end;
+			options.eval_steps = strtoull(steps, &end, 10);
+			if (!*steps || *end || *steps == '-') {
+				warnx("Invalid number of steps %s", steps);
+				usage(argv[0], stderr, 1);
+			}
+		} else if (argv[argpos][1] == 'O' && argv[argpos][2] >= '0' && argv[argpos][2] <= '0' + MAX_OPT_LEVEL && !argv[argpos][3]) {
+			pipeline_preset(&options.pipeline, argv[argpos][2] - '0');
+		} else if (!strncmp(argv[argpos], "--passes=", strlen("--passes="))) {
+			if (!pipeline_parse(&options.pipeline, argv[argpos] + strlen("--passes="))) {
+				warnx("Invalid list of passes %s", argv[argpos] + strlen("--passes="));
+				usage(argv[0], stderr, 1);
+			}
+		} else if (!strncmp(argv[argpos], "--disable-pass=", strlen("--disable-pass="))) {
+			pass_pipeline check = options.pipeline;
+			if (!pipeline_disable(&check, argv[argpos] + strlen("--disable-pass="))) {
+				warnx("Invalid pass %s", argv[argpos] + strlen("--disable-pass="));
+				usage(argv[0], stderr, 1);
+			}
+			disabled_passes[disabled_count++] = argv[argpos] + strlen("--disable-pass=");
+		} else if (!strcmp(argv[argpos], "--time-passes")) {
+			options.pipeline.time_passes = true;
+		} else if (!strcmp(argv[argpos], "--output-buffering=line")) {
+			options.buffering = BUFFER_LINE;
+		} else if (!strcmp(argv[argpos], "--output-buffering=full")) {
+			options.buffering = BUFFER_FULL;
 		} else if (!strcmp(argv[argpos], "--")) {
 			argpos++;
 			break;
@@ -67,6 +226,10 @@ int main(int argc, char **argv){
 		}
 	}
 
+	for (size_t i = 0; i < disabled_count; i++)
+		pipeline_disable(&options.pipeline, disabled_passes[i]);
+	free(disabled_passes);
+
 	if (argpos < argc - 1) {
 		warnx("Cannot handle more than 1 filename.\nUse an external utility like cat if you want to join source code together.");
 		usage(argv[0], stderr, 1);
@@ -80,32 +243,59 @@ int main(int argc, char **argv){
 
 		if (!file) err(1, "Can't open file %s", filename);
 	} else {
+		if (options.annotate)
+			errx(1, "Can't annotate a program read from stdin");
+		if (batching)
+			errx(1, "Can't run a batch of a program read from stdin");
+		if (cache_dir)
+			errx(1, "Can't cache a program read from stdin");
 		file = stdin;
+		// Read the program a byte at a time so none of its input gets swallowed with it
+		setvbuf(stdin, NULL, _IONBF, 0);
 	}
 
-	bf_op root = build_bf_tree(file, file == stdin);
-
-	if (file != stdin)
-		fclose(file);
-
-	if (dump_tree)
-		print_bf_op(&root, 0);
-
-	blob_cursor flat = {
-		.data = malloc(128),
-		.pos = 0,
-		.len = 128,
-	};
-	interpreter_meta meta = flatten_bf(&root, &flat);
+	bytecode_file loaded = {0};
+	char *cache_path = NULL;
+	if (file != stdin && bytecode_file_map(file, &loaded)) {
+		// Already compiled, which decides the cell width and (mostly) the tape
+		if (options.dump_tree || options.annotate)
+			errx(1, "Can't show the source of a program which was loaded as bytecode");
+		if (cell_bits_given && cell_bits != loaded.header->cell_bits)
+			errx(1, "The bytecode was compiled for %d-bit cells", loaded.header->cell_bits);
+		if (loaded.header->tape_kind > TAPE_FIXED_65536 || !find_variant(loaded.header->cell_bits, loaded.header->tape_kind))
+			errx(1, "The bytecode was compiled for a kind of tape or cell which isn't built in");
+		if (tape_given && !bytecode_tape_compatible(loaded.header->tape_kind, options.tape_kind))
+			errx(1, "The bytecode was compiled for a different kind of tape");
 
-	// For the tiny savings this will give us...
-	free_bf_op_children(&root);
+		cell_bits = loaded.header->cell_bits;
+		if (!tape_given)
+			options.tape_kind = loaded.header->tape_kind;
+		options.loaded = &loaded;
+	} else if (cache_dir && !options.dump_tree && !options.annotate && !options.pipeline.time_passes) {
+		// Those need the parsed source, so they always compile it
+		cache_path = cache_lookup(cache_dir, file, cell_bits, options.tape_kind, options.eval_steps, &options.pipeline, &options.source, &loaded);
+		if (loaded.header)
+			options.loaded = &loaded;
+		else
+			options.cache_path = cache_path;
+	}
 
-	if (dump_opcodes)
-		print_flattened(flat.data);
+	if (batching) {
+		if (options.profile || options.count_sequences)
+			errx(1, "Can't profile a batch");
 
-	if (execute)
-		execute_bf(flat.data, meta);
+		batch_read_inputs(&inputs, stdin);
+		if (!inputs.jobs) {
+			long processors = sysconf(_SC_NPROCESSORS_ONLN);
+			inputs.jobs = processors > 0 ? processors : 1;
+		}
+		options.batch = &inputs;
+	}
 
-	free(flat.data);
+	int status = find_variant(cell_bits, options.tape_kind)(file, &options);
+	batch_free(&inputs);
+	bytecode_file_unmap(&loaded);
+	free(cache_path);
+	free(default_cache_dir);
+	return status;
 }
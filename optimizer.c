@@ -1,10 +1,13 @@
 #include <assert.h>
 #include <stdbool.h>
+#include <stdint.h>
 #include <string.h>
 
+#include "flattener.h"
 #include "optimizer.h"
 #include "optimizer_helpers.h"
 #include "parser.h"
+#include "tape.h"
 
 /*
  * Determines whether a loop is "alter-only" or not.
@@ -23,40 +26,6 @@ static bool is_loop_alter_only(bf_op *restrict op) {
 	return true;
 }
 
-static bool move_addition(bf_op_builder *restrict arr, size_t add_pos) {
-	assert(add_pos < arr->len);
-	assert(arr->ops[add_pos].op_type == BF_OP_ALTER);
-	assert(arr->ops[add_pos].offset == 0);
-
-	ssize_t offset = 0;
-	size_t final_pos = add_pos + 1;
-
-	bool found_spot = false;
-
-	for (; final_pos < arr->len; final_pos++) {
-		bf_op *restrict op = &arr->ops[final_pos];
-		if (op->op_type == BF_OP_ALTER && op->offset == -offset) {
-			found_spot = true;
-			break;
-		}
-		if (offset_might_be_accessed(-offset, arr, final_pos, final_pos + 1, true, true))
-			break;  // Can't move the addition past an instruction which would clobber or use it
-		else if (op->op_type == BF_OP_LOOP) {
-			loop_info info = get_loop_info(op);
-			if (info.uncertain_backwards || info.uncertain_forwards)
-				break;  // At this point it's difficult to determine the correct offset
-		} else
-			offset += get_final_offset(op);
-	}
-
-	if (!found_spot) return false;
-
-	assert(arr->ops[final_pos].op_type == BF_OP_ALTER);
-	arr->ops[final_pos].amount += arr->ops[add_pos].amount;
-	remove_bf_ops(arr, add_pos, 1);
-	return true;
-}
-
 static void make_offsets_absolute(bf_op *restrict op) {
 	assert(op != NULL);
 	assert(op->op_type == BF_OP_LOOP);
@@ -94,6 +63,7 @@ static bool make_loop_into_multiply(bf_op_builder *ops) {
 
 	size_t my_op_index = ops->len - 1;
 	bf_op *op = &ops->ops[my_op_index];
+	source_range source = op->source;  // The ops replacing the loop all come from the whole of it
 
 	assert(op->op_type == BF_OP_LOOP);
 
@@ -112,16 +82,31 @@ error:
 		return false;
 	}
 
-	// ensure the loop variable decreases by one each time
 	cell_int loop_increment = 0;
 	for (size_t i = 0; i < op->children.len; i++)
 		if (op->children.ops[i].offset == 0)
 			loop_increment += op->children.ops[i].amount;
 
-	bool positive;
-	if (loop_increment == (cell_int)-1) positive = true; // Take away 1 each time = use positive value of cell as loop counter
-	else if (loop_increment == 1) positive = false;
-	else goto error;
+	// A loop which doesn't change its counter never stops (or never starts)
+	if (loop_increment == 0) goto error;
+
+	/*
+	 * The loop runs until the counter wraps round to zero, which takes
+	 * counter * -1/increment runs if the increment is odd, so that can be
+	 * folded into the amounts.  Otherwise, a DIVIDE first turns the counter
+	 * into the number of runs, or hangs if the loop never stops.
+	 */
+	cell_int scale = 1;
+	if (loop_increment & 1) {
+		scale = -cell_inverse(loop_increment);
+	} else {
+		*alloc_bf_op(ops) = (bf_op) {
+			.op_type = BF_OP_DIVIDE,
+			.amount = loop_increment,
+			.source = source,
+		};
+		op = &ops->ops[my_op_index];
+	}
 
 	// Go along finding and removing all alter ops with the same offset
 	while (op->children.len) {
@@ -137,12 +122,13 @@ error:
 			remove_bf_ops(&op->children, i--, 1);
 		}
 
-		if (!positive) final_amount = -final_amount;
+		final_amount = (cell_int)((uint64_t)final_amount * (uint64_t)scale);
 		if (target_offset != 0) {
 			*alloc_bf_op(ops) = (bf_op) {
 				.op_type = BF_OP_MULTIPLY,
 				.offset = target_offset,
 				.amount = final_amount,
+				.source = source,
 			};
 			op = &ops->ops[my_op_index];
 		}
@@ -154,34 +140,547 @@ error:
 		.op_type = BF_OP_SET,
 		.offset = 0,
 		.amount = 0,
+		.source = source,
+	};
+	return true;
+}
+
+// How many cells a loop nest can involve and still be worked out in closed form
+#define NEST_MAX_CELLS 16
+
+/*
+ * What one run of a loop's body does to the cells it involves: each one ends
+ * up as a constant plus some multiple of what every cell was before the run.
+ */
+typedef struct {
+	size_t count;
+	ssize_t offsets[NEST_MAX_CELLS];
+	bool written[NEST_MAX_CELLS];
+	cell_int constant[NEST_MAX_CELLS];
+	cell_int coefficient[NEST_MAX_CELLS][NEST_MAX_CELLS];  // By cell, then by the cell it was multiplied from
+} body_effect;
+
+static cell_int cell_product(cell_int a, cell_int b) {
+	return (cell_int)((uint64_t)a * (uint64_t)b);
+}
+
+// Gets the index of the cell at the offset, or -1 if there are too many cells
+static int effect_cell(body_effect *effect, ssize_t offset) {
+	for (size_t i = 0; i < effect->count; i++)
+		if (effect->offsets[i] == offset)
+			return (int)i;
+	if (effect->count == NEST_MAX_CELLS)
+		return -1;
+
+	size_t cell = effect->count++;
+	effect->offsets[cell] = offset;
+	effect->coefficient[cell][cell] = 1;
+	return (int)cell;
+}
+
+/*
+ * Works out the effect of a balanced loop body made of nothing but ALTERs,
+ * SETs and MULTIPLYs.  Returns false if the body is anything else.
+ */
+static bool get_body_effect(bf_op_builder *children, body_effect *effect) {
+	*effect = (body_effect) {0};
+	ssize_t pos = 0;
+	for (size_t i = 0; i < children->len; i++) {
+		bf_op *op = &children->ops[i];
+		switch (op->op_type) {
+			case BF_OP_ALTER: {
+				pos += op->offset;
+				if (!op->amount)
+					break;
+				int cell = effect_cell(effect, pos);
+				if (cell < 0) return false;
+				effect->constant[cell] += op->amount;
+				effect->written[cell] = true;
+				break;
+			}
+
+			case BF_OP_SET:
+				for (ssize_t j = 0; j <= op->offset; j++) {
+					int cell = effect_cell(effect, pos + j);
+					if (cell < 0) return false;
+					memset(effect->coefficient[cell], 0, sizeof effect->coefficient[cell]);
+					effect->constant[cell] = op->amount;
+					effect->written[cell] = true;
+				}
+				break;
+
+			case BF_OP_MULTIPLY: {
+				int from = effect_cell(effect, pos);
+				int to = effect_cell(effect, pos + op->offset);
+				if (from < 0 || to < 0 || from == to) return false;
+				for (size_t j = 0; j < effect->count; j++)
+					effect->coefficient[to][j] += cell_product(effect->coefficient[from][j], op->amount);
+				effect->constant[to] += cell_product(effect->constant[from], op->amount);
+				effect->written[to] = true;
+				break;
+			}
+
+			default:
+				return false;
+		}
+	}
+	return pos == 0;
+}
+
+/*
+ * Works out loops whose bodies hold inner loops which have become MULTIPLYs
+ * and SETs, such as "[>[->+>+<<]>>[-<<+>>]<<<-]".  From the second run of the
+ * body on, the cells it sets to constants hold those constants, so if every
+ * other cell then either keeps its value or has the same sum of products of
+ * cells which keep theirs added to it each time, all of the runs after the
+ * first can be done at once.  The loop is left to run its body once, followed
+ * by PRODUCTs and MULTIPLYs by the number of runs left, and then stops.
+ */
+static bool make_nest_into_products(bf_op *op) {
+	assert(op->op_type == BF_OP_LOOP);
+
+	body_effect effect;
+	if (!get_body_effect(&op->children, &effect))
+		return false;
+
+	int counter = effect_cell(&effect, 0);
+	if (counter < 0 || !effect.written[counter])
+		return false;
+
+	bool constant[NEST_MAX_CELLS] = {0};
+	for (size_t i = 0; i < effect.count; i++) {
+		constant[i] = effect.written[i];
+		for (size_t j = 0; j < effect.count; j++)
+			if (effect.coefficient[i][j] != 0)
+				constant[i] = false;
+	}
+
+	// What each run after the first does, with the constants put in
+	for (size_t i = 0; i < effect.count; i++) {
+		for (size_t j = 0; j < effect.count; j++) {
+			if (!constant[j] || effect.coefficient[i][j] == 0)
+				continue;
+			effect.constant[i] += cell_product(effect.coefficient[i][j], effect.constant[j]);
+			effect.coefficient[i][j] = 0;
+		}
+	}
+
+	// Every cell but the constants has to be added to, and not scaled
+	bool kept[NEST_MAX_CELLS] = {0};
+	for (size_t i = 0; i < effect.count; i++) {
+		if (constant[i])
+			continue;
+		if (effect.coefficient[i][i] != 1)
+			return false;
+		kept[i] = effect.constant[i] == 0;
+		for (size_t j = 0; j < effect.count; j++)
+			if (j != i && effect.coefficient[i][j] != 0)
+				kept[i] = false;
+	}
+
+	cell_int step = effect.constant[counter];
+	if (constant[counter] || step == 0)
+		return false;
+
+	// The counter mustn't depend on anything, and what's added mustn't change
+	for (size_t i = 0; i < effect.count; i++) {
+		for (size_t j = 0; j < effect.count; j++) {
+			if (j == i || effect.coefficient[i][j] == 0)
+				continue;
+			if ((int)i == counter || (int)j == counter || !kept[j])
+				return false;
+		}
+	}
+
+	bf_op_builder *body = &op->children;
+	source_range source = op->source;
+
+	// The rest of the runs are counted as make_loop_into_multiply does
+	cell_int scale = 1;
+	if (step & 1) {
+		scale = -cell_inverse(step);
+	} else {
+		*alloc_bf_op(body) = (bf_op) {
+			.op_type = BF_OP_DIVIDE,
+			.amount = step,
+			.source = source,
+		};
+	}
+
+	for (size_t i = 0; i < effect.count; i++) {
+		if ((int)i == counter || kept[i] || constant[i])
+			continue;
+		for (size_t j = 0; j < effect.count; j++) {
+			if (j == i || effect.coefficient[i][j] == 0)
+				continue;
+			*alloc_bf_op(body) = (bf_op) {
+				.op_type = BF_OP_PRODUCT,
+				.offset = effect.offsets[i],
+				.factor = effect.offsets[j],
+				.amount = cell_product(effect.coefficient[i][j], scale),
+				.source = source,
+			};
+		}
+	}
+
+	// The MULTIPLYs go last, straight before the SET they have to end in
+	for (size_t i = 0; i < effect.count; i++) {
+		if ((int)i == counter || constant[i] || effect.constant[i] == 0)
+			continue;
+		*alloc_bf_op(body) = (bf_op) {
+			.op_type = BF_OP_MULTIPLY,
+			.offset = effect.offsets[i],
+			.amount = cell_product(effect.constant[i], scale),
+			.source = source,
+		};
+	}
+
+	*alloc_bf_op(body) = (bf_op) {
+		.op_type = BF_OP_SET,
+		.offset = 0,
+		.amount = 0,
+		.source = source,
+	};
+	return true;
+}
+
+/*
+ * The ops being peephole optimized, as a doubly linked list threaded through
+ * the builder's array, so that removing an op doesn't move all of the ones
+ * after it.  Removed ops are left in the array as tombstones, and new ones go
+ * on the end of it; the list is compacted back into an array in one go once
+ * the pass is done.
+ */
+#define NO_OP ((size_t)-1)
+// How many ops the links for a pass can cover before they move to the heap
+#define PEEPHOLE_FIXED_LINKS 64
+
+/*
+ * Long lists are indexed by where the pointer is before each op, in blocks
+ * of 64 and 4096 ops, with the range of cells each block's ops might touch.
+ * move_addition can then skip whole blocks which don't touch the cell it's
+ * following.
+ */
+#define TOUCH_BLOCK_BITS 6
+#define TOUCH_LEVELS 2
+#define TOUCH_INDEX_MIN 256
+
+typedef struct {
+	size_t prev, next;
+	unsigned zero_scan, nonzero_scan;  // The last marking scans to reach the op
+} op_link;
+
+typedef struct {
+	ssize_t min, max;  // The cells the ops might touch (none if min > max)
+	bool opaque;  // If an op in it has to be looked at whatever the cell
+} touch_summary;
+
+typedef struct {
+	bf_op_builder *ops;
+	op_link *links, *fixed_links;
+	size_t links_alloc;
+	size_t first;
+	bool appended;  // If any ops have gone on the end, out of order
+
+	/*
+	 * The last scans of mark_as_zero and mark_as_nonzero, or 0 if an op
+	 * they reached has changed since.  A scan which starts at one of those
+	 * ops would do nothing new.
+	 */
+	unsigned scans, zero_scan, nonzero_scan;
+
+	size_t indexed;  // How many of the ops are in the touch index
+	ssize_t *pos_before;  // Give or take a constant between skips and loops
+	touch_summary *summaries[TOUCH_LEVELS];
+} op_list;
+
+static bf_op *list_op(op_list *list, size_t op) {
+	return &list->ops->ops[op];
+}
+
+static size_t list_prev(op_list *list, size_t op) {
+	return list->links[op].prev;
+}
+
+static size_t list_next(op_list *list, size_t op) {
+	return list->links[op].next;
+}
+
+// Gets the range of cells the op might touch, if it can be told from the op alone
+static bool touch_range(bf_op *op, ssize_t pos, ssize_t *min, ssize_t *max) {
+	ssize_t other = pos;
+	switch (op->op_type) {
+		case BF_OP_ALTER:
+			pos += op->offset;
+			other = pos;
+			break;
+		case BF_OP_SET:
+		case BF_OP_MULTIPLY:
+		case BF_OP_ADD_AT:
+		case BF_OP_SET_AT:
+		case BF_OP_IN_AT:
+		case BF_OP_OUT_AT:
+			other = pos + op->offset;
+			break;
+		case BF_OP_PRODUCT: {
+			ssize_t low = op->offset < op->factor ? op->offset : op->factor;
+			ssize_t high = op->offset < op->factor ? op->factor : op->offset;
+			*min = pos + (low < 0 ? low : 0);
+			*max = pos + (high > 0 ? high : 0);
+			return true;
+		}
+		case BF_OP_IN:
+		case BF_OP_OUT:
+		case BF_OP_DIVIDE:
+		case BF_OP_WRITE_CONST:
+			break;
+		default:
+			return false;
+	}
+	*min = pos < other ? pos : other;
+	*max = pos < other ? other : pos;
+	return true;
+}
+
+// Adds the op to the summaries of its blocks, or makes them opaque
+static void index_op(op_list *list, size_t op, bool opaque) {
+	if (op >= list->indexed)
+		return;
+
+	ssize_t min, max;
+	opaque = opaque || !touch_range(list_op(list, op), list->pos_before[op], &min, &max);
+	for (int level = 0; level < TOUCH_LEVELS; level++) {
+		touch_summary *summary = &list->summaries[level][op >> (TOUCH_BLOCK_BITS * (level + 1))];
+		if (opaque) {
+			summary->opaque = true;
+		} else if (summary->min > summary->max) {
+			summary->min = min;
+			summary->max = max;
+		} else {
+			if (min < summary->min) summary->min = min;
+			if (max > summary->max) summary->max = max;
+		}
+	}
+}
+
+/*
+ * Must be called whenever an op in the list changes.  Summaries only ever
+ * grow, so they stay right for the ops which have gone.
+ */
+static void list_modified(op_list *list, size_t op) {
+	if (list->links[op].zero_scan == list->zero_scan)
+		list->zero_scan = 0;
+	if (list->links[op].nonzero_scan == list->nonzero_scan)
+		list->nonzero_scan = 0;
+	index_op(list, op, false);
+}
+
+// Takes the op out of the list, returning the one which was after it
+static size_t list_remove(op_list *list, size_t op) {
+	list_modified(list, op);
+	op_link link = list->links[op];
+	if (link.prev != NO_OP)
+		list->links[link.prev].next = link.next;
+	else
+		list->first = link.next;
+	if (link.next != NO_OP)
+		list->links[link.next].prev = link.prev;
+
+	list_op(list, op)->op_type = BF_OP_INVALID;
+	return link.next;
+}
+
+// Adds a copy of the op after another, returning where it went
+static size_t list_insert_after(op_list *list, size_t after, bf_op const *op) {
+	size_t added = list->ops->len;
+	*alloc_bf_op(list->ops) = *op;
+	if (added == list->links_alloc)
+		list->links = grow_stack(list->links, list->fixed_links, &list->links_alloc, sizeof *list->links);
+
+	size_t next = list->links[after].next;
+	list->links[added] = (op_link) {.prev = after, .next = next};
+	list->links[after].next = added;
+	if (next != NO_OP)
+		list->links[next].prev = added;
+	list->appended = true;
+
+	// The ops after this one are no longer the next ones in the array
+	list_modified(list, after);
+	index_op(list, after, true);
+	return added;
+}
+
+static void list_init(op_list *list, bf_op_builder *ops, op_link *fixed_links) {
+	*list = (op_list) {
+		.ops = ops,
+		.links = fixed_links,
+		.fixed_links = fixed_links,
+		.links_alloc = PEEPHOLE_FIXED_LINKS,
+		.first = ops->len ? 0 : NO_OP,
 	};
+	while (list->links_alloc < ops->len)
+		list->links = grow_stack(list->links, fixed_links, &list->links_alloc, sizeof *list->links);
+
+	for (size_t i = 0; i < ops->len; i++)
+		list->links[i] = (op_link) {.prev = i ? i - 1 : NO_OP, .next = i + 1 < ops->len ? i + 1 : NO_OP};
+
+	if (ops->len < TOUCH_INDEX_MIN)
+		return;
+
+	list->indexed = ops->len;
+	list->pos_before = malloc(ops->len * sizeof *list->pos_before);
+	for (int level = 0; level < TOUCH_LEVELS; level++) {
+		size_t blocks = (ops->len >> (TOUCH_BLOCK_BITS * (level + 1))) + 1;
+		list->summaries[level] = malloc(blocks * sizeof *list->summaries[level]);
+		for (size_t i = 0; i < blocks; i++)
+			list->summaries[level][i] = (touch_summary) {.min = 1, .max = 0};
+	}
+
+	// Loops and skips count as not moving, like they do for move_addition
+	ssize_t pos = 0;
+	for (size_t i = 0; i < ops->len; i++) {
+		list->pos_before[i] = pos;
+		index_op(list, i, false);
+		if (ops->ops[i].op_type == BF_OP_ALTER)
+			pos += ops->ops[i].offset;
+	}
+}
+
+/*
+ * Puts the ops left in the list back into the builder, in order.  If none
+ * were added, the list is still in the array's order and can be compacted in
+ * place.
+ */
+static void list_compact(op_list *list) {
+	bf_op_builder *ops = list->ops;
+	size_t count = 0;
+	for (size_t op = list->first; op != NO_OP; op = list_next(list, op))
+		count++;
+
+	bf_op *compacted = ops->ops;
+	if (list->appended)
+		compacted = bf_arena_alloc(ops->arena, count * sizeof *compacted);
+
+	size_t to = 0;
+	for (size_t op = list->first; op != NO_OP; op = list_next(list, op)) {
+		if (to != op || list->appended)
+			compacted[to] = ops->ops[op];
+		to++;
+	}
+
+	if (list->appended) {
+		ops->ops = compacted;
+		ops->alloc = count;
+	}
+	ops->len = count;
+
+	if (list->links != list->fixed_links)
+		free(list->links);
+	free(list->pos_before);
+	for (int level = 0; level < TOUCH_LEVELS; level++)
+		free(list->summaries[level]);
+}
+
+/*
+ * Skips over whole blocks of ops, starting at the given one, which can't
+ * touch the cell at the offset from it, adding their moves to the offset.
+ * Returns the op to carry on from.
+ */
+static size_t skip_untouched(op_list *list, size_t op, ssize_t *offset) {
+	while (op < list->indexed) {
+		ssize_t cell = list->pos_before[op] - *offset;
+		size_t to = op;
+		for (int level = TOUCH_LEVELS - 1; level >= 0 && to == op; level--) {
+			unsigned bits = TOUCH_BLOCK_BITS * (level + 1);
+			if (op & (((size_t)1 << bits) - 1))
+				continue;
+
+			touch_summary *summary = &list->summaries[level][op >> bits];
+			if (summary->opaque || (cell >= summary->min && cell <= summary->max))
+				continue;
+
+			size_t end = op + ((size_t)1 << bits);
+			if (end >= list->indexed)
+				return NO_OP;  // Only an opaque block can have ops added after it
+			if (list_op(list, end)->op_type != BF_OP_INVALID)
+				to = end;
+		}
+		if (to == op)
+			break;
+
+		*offset += list->pos_before[to] - list->pos_before[op];
+		op = to;
+	}
+	return op;
+}
+
+// Whether the op alone might use or clobber the cell at the offset
+static bool op_might_access(ssize_t offset, bf_op *op) {
+	bf_op_builder just_op = {.ops = op, .len = 1, .alloc = 1};
+	return offset_might_be_accessed(offset, &just_op, 0, 1, true, true);
+}
+
+static bool move_addition(op_list *list, size_t add_op) {
+	assert(list_op(list, add_op)->op_type == BF_OP_ALTER);
+	assert(list_op(list, add_op)->offset == 0);
+
+	ssize_t offset = 0;
+	size_t final_op = skip_untouched(list, list_next(list, add_op), &offset);
+
+	bool found_spot = false;
+
+	for (; final_op != NO_OP; final_op = skip_untouched(list, list_next(list, final_op), &offset)) {
+		bf_op *restrict op = list_op(list, final_op);
+		if (op->op_type == BF_OP_ALTER && op->offset == -offset) {
+			found_spot = true;
+			break;
+		}
+		if (op_might_access(-offset, op))
+			break;  // Can't move the addition past an instruction which would clobber or use it
+		else if (op->op_type == BF_OP_LOOP) {
+			loop_info info = get_loop_info(op);
+			if (info.uncertain_backwards || info.uncertain_forwards)
+				break;  // At this point it's difficult to determine the correct offset
+		} else
+			offset += get_final_offset(op);
+	}
+
+	if (!found_spot) return false;
+
+	assert(list_op(list, final_op)->op_type == BF_OP_ALTER);
+	list_op(list, final_op)->amount += list_op(list, add_op)->amount;
+	list_modified(list, final_op);
+	list_remove(list, add_op);
 	return true;
 }
 
-static bool can_merge_set_ops(bf_op_builder *restrict arr, size_t pos) {
+static bool can_merge_set_ops(op_list *list, size_t op) {
 	// We need a lookbehind of 2
-	if (pos < 2) return false;
+	size_t alter = list_prev(list, op);
+	if (alter == NO_OP) return false;
+	size_t set = list_prev(list, alter);
+	if (set == NO_OP) return false;
 
 	// Looking for SET ALTER SET (e.g. "[-]>[-]")
-	if (arr->ops[pos].op_type != BF_OP_SET) return false;
-	if (arr->ops[pos - 1].op_type != BF_OP_ALTER) return false;
-	if (arr->ops[pos - 2].op_type != BF_OP_SET) return false;
+	if (list_op(list, op)->op_type != BF_OP_SET) return false;
+	if (list_op(list, alter)->op_type != BF_OP_ALTER) return false;
+	if (list_op(list, set)->op_type != BF_OP_SET) return false;
 
 	// The alter must bring us exactly 1 cell past the first (multi-)SET
 	// (also, we don't care about its amount; a SET overwrites it)
-	if (arr->ops[pos - 1].offset != 1 + arr->ops[pos - 2].offset) return false;
+	if (list_op(list, alter)->offset != 1 + list_op(list, set)->offset) return false;
 	// The amounts to SET to must be identical
-	if (arr->ops[pos - 2].amount != arr->ops[pos].amount) return false;
+	if (list_op(list, set)->amount != list_op(list, op)->amount) return false;
 
 	return true;
 }
 
-static bool is_redundant_set_lookahead(bf_op_builder *restrict arr, size_t pos) {
-	bf_op *op = &arr->ops[pos];
+static bool is_redundant_set_lookahead(op_list *list, size_t pos) {
+	bf_op *op = list_op(list, pos);
 	if (op->op_type != BF_OP_SET) return false;
 
-	if (pos + 1 < arr->len) {
-		bf_op *next = &arr->ops[pos + 1];
+	if (list_next(list, pos) != NO_OP) {
+		bf_op *next = list_op(list, list_next(list, pos));
 		// If there's a SET after us, covering a wider or equal range of
 		// offsets, this one isn't necessary.
 		if (next->op_type == BF_OP_SET && op->offset <= next->offset)
@@ -191,8 +690,7 @@ static bool is_redundant_set_lookahead(bf_op_builder *restrict arr, size_t pos)
 	return false;
 }
 
-static bool is_redundant_alter(bf_op_builder *arr, size_t pos) {
-	bf_op *op = &arr->ops[pos];
+static bool is_redundant_alter(bf_op *op) {
 	if (op->op_type != BF_OP_ALTER) return false;
 
 	// If this ALTER alters nothing, it's redundant
@@ -201,20 +699,39 @@ static bool is_redundant_alter(bf_op_builder *arr, size_t pos) {
 	return false;
 }
 
-static bool is_redundant(bf_op_builder *arr, size_t pos) {
-	if (is_redundant_alter(arr, pos)) return true;
+static bool is_redundant(bf_op *op) {
+	if (is_redundant_alter(op)) return true;
 
-	bf_op *op = &arr->ops[pos];
 	if (op->definitely_zero && expects_nonzero(op)) return true;
 
 	return false;
 }
 
-static void mark_as_zero(bf_op_builder *ops, size_t initial_pos, bool all_zeros) {
-	for (size_t pos = initial_pos; pos < ops->len; pos++) {
-		bf_op *op = &ops->ops[pos];
+/*
+ * Starts a marking scan, stamping the ops it reaches with a new id.  Returns
+ * 0 if the last scan of the same kind already went from the op, so this one
+ * wouldn't change anything.
+ */
+static unsigned start_scan(op_list *list, size_t initial_op, unsigned *last_scan, bool zero) {
+	op_link *link = &list->links[initial_op];
+	if (*last_scan && (zero ? link->zero_scan : link->nonzero_scan) == *last_scan)
+		return 0;
+	*last_scan = ++list->scans;
+	return *last_scan;
+}
+
+static void mark_as_zero(op_list *list, size_t initial_op, bool all_zeros) {
+	// Everything being zero isn't remembered, so it needn't be checked
+	unsigned scan = all_zeros ? 0 : start_scan(list, initial_op, &list->zero_scan, true);
+	if (!scan && !all_zeros)
+		return;
+
+	for (size_t pos = initial_op; pos != NO_OP; pos = list_next(list, pos)) {
+		bf_op *op = list_op(list, pos);
 
 		op->definitely_zero = true;
+		if (scan)
+			list->links[pos].zero_scan = scan;
 
 		if (!ensures_zero(op)) {
 			if (writes_cell(op))
@@ -226,11 +743,16 @@ static void mark_as_zero(bf_op_builder *ops, size_t initial_pos, bool all_zeros)
 	}
 }
 
-static void mark_as_nonzero(bf_op_builder *ops, size_t initial_pos) {
-	for (size_t pos = initial_pos; pos < ops->len; pos++) {
-		bf_op *op = &ops->ops[pos];
+static void mark_as_nonzero(op_list *list, size_t initial_op) {
+	unsigned scan = start_scan(list, initial_op, &list->nonzero_scan, false);
+	if (!scan)
+		return;
+
+	for (size_t pos = initial_op; pos != NO_OP; pos = list_next(list, pos)) {
+		bf_op *op = list_op(list, pos);
 
 		op->definitely_nonzero = true;
+		list->links[pos].nonzero_scan = scan;
 
 		if (!ensures_nonzero(op)) {
 			if (writes_cell(op))
@@ -242,11 +764,11 @@ static void mark_as_nonzero(bf_op_builder *ops, size_t initial_pos) {
 	}
 }
 
-static bool can_merge_alter(bf_op_builder *ops, size_t pos) {
-	if (pos < 1) return false;
+static bool can_merge_alter(op_list *list, size_t pos) {
+	if (list_prev(list, pos) == NO_OP) return false;
 
-	bf_op *left = &ops->ops[pos - 1];
-	bf_op *right = &ops->ops[pos];
+	bf_op *left = list_op(list, list_prev(list, pos));
+	bf_op *right = list_op(list, pos);
 
 	if (right->op_type != BF_OP_ALTER) return false;
 
@@ -266,16 +788,21 @@ static bool can_merge_alter(bf_op_builder *ops, size_t pos) {
 	return true;
 }
 
-static void merge_alter(bf_op_builder *ops, size_t pos) {
-	assert(can_merge_alter(ops, pos));
+// Returns the op which the right one was merged into
+static size_t merge_alter(op_list *list, size_t pos) {
+	assert(can_merge_alter(list, pos));
 
-	bf_op *left = &ops->ops[pos - 1];
-	bf_op *right = &ops->ops[pos];
+	size_t left_pos = list_prev(list, pos);
+	bf_op *left = list_op(list, left_pos);
+	bf_op *right = list_op(list, pos);
 
 	left->offset += right->offset;
 	left->amount += right->amount;
+	left->source = source_range_union(left->source, right->source);
 
-	remove_bf_ops(ops, pos, 1);
+	list_modified(list, left_pos);
+	list_remove(list, pos);
+	return left_pos;
 }
 
 static bool loops_exactly_once(bf_op *op) {
@@ -284,114 +811,224 @@ static bool loops_exactly_once(bf_op *op) {
 	return get_loop_info(op).loops_once_at_most;
 }
 
-static void remove_looping(bf_op_builder *ops, size_t loop_pos) {
-	size_t loop_len = ops->ops[loop_pos].children.len;
+// Replaces the loop with its children, the first of which takes its place
+static void remove_looping(op_list *list, size_t loop_pos) {
+	bf_op_builder children = list_op(list, loop_pos)->children;
+	assert(children.len != 0);
 
-	bf_op *inlined_ops = insert_bf_ops(ops, loop_pos, loop_len);
-	loop_pos += loop_len;
-	bf_op *loop = &ops->ops[loop_pos];
-	memcpy(inlined_ops, loop->children.ops, loop_len * sizeof *inlined_ops);
-
-	// remove_bf_ops does a deep free of the loop structure, so prevent that by
-	// freeing and discarding the structure ourselves (but in a shallow way)
-	free(loop->children.ops);
-	loop->children = (bf_op_builder) {0};
-
-	remove_bf_ops(ops, loop_pos, 1);
+	*list_op(list, loop_pos) = children.ops[0];
+	list_modified(list, loop_pos);
+	size_t after = loop_pos;
+	for (size_t i = 1; i < children.len; i++)
+		after = list_insert_after(list, after, &children.ops[i]);
 }
 
-static void peephole_optimize(bf_op_builder *ops, bool starts_nonzero) {
-	for (size_t i = 0; i < ops->len; i++) {
-		bf_op *child = &ops->ops[i];
-
-		if (i > 0) {
-			bf_op *prev = &ops->ops[i - 1];
+/*
+ * Every rewrite is of the op being looked at or the ones just before it, so
+ * after one, the pass carries on from the earliest op which changed.
+ */
+static void peephole_optimize(bf_op_builder *ops, bool starts_nonzero, bool tape_zero) {
+	op_link fixed_links[PEEPHOLE_FIXED_LINKS];
+	op_list list;
+	list_init(&list, ops, fixed_links);
+
+	if (tape_zero)
+		mark_as_zero(&list, list.first, true);
+
+	for (size_t pos = list.first; pos != NO_OP;) {
+		size_t prev_pos = list_prev(&list, pos);
+		if (prev_pos != NO_OP) {
+			bf_op *prev = list_op(&list, prev_pos);
 			if (prev->definitely_zero)
-				mark_as_zero(ops, i - 1, false);
+				mark_as_zero(&list, prev_pos, false);
 			else if (ensures_zero(prev))
-				mark_as_zero(ops, i, false);
+				mark_as_zero(&list, pos, false);
 
 			if (prev->definitely_nonzero)
-				mark_as_nonzero(ops, i - 1);
+				mark_as_nonzero(&list, prev_pos);
 			else if (ensures_nonzero(prev))
-				mark_as_nonzero(ops, i);
+				mark_as_nonzero(&list, pos);
 		} else if (starts_nonzero) {
-			mark_as_nonzero(ops, 0);
+			mark_as_nonzero(&list, pos);
 		}
 
+		bf_op *child = list_op(&list, pos);
 		assert(!(child->definitely_zero && child->definitely_nonzero));
 
-		if (is_redundant(ops, i)) {
-			remove_bf_ops(ops, i--, 1);
-		} else if (is_redundant_set_lookahead(ops, i)) {
+		if (is_redundant(child)) {
+			pos = list_remove(&list, pos);
+		} else if (is_redundant_set_lookahead(&list, pos)) {
 			// Since this looks ahead to determine if the next instruction
 			// makes it redundant, the next op's assumptions about
 			// 'definitely_zero'/'definitely_nonzero' will be incorrect once
 			// this is removed.  They should be copied over from this op.
-			bf_op *next = &ops->ops[i + 1];
+			bf_op *next = list_op(&list, list_next(&list, pos));
 			next->definitely_zero = child->definitely_zero;
 			next->definitely_nonzero = child->definitely_nonzero;
-			remove_bf_ops(ops, i--, 1);
-		} else if (can_merge_alter(ops, i)) {
-			merge_alter(ops, i);
-			i -= 2;  // The instruction before changed too, so rerun the optimizer there
+			list_modified(&list, list_next(&list, pos));
+			pos = list_remove(&list, pos);
+		} else if (can_merge_alter(&list, pos)) {
+			// The instruction before changed too, so rerun the optimizer there
+			pos = merge_alter(&list, pos);
 		} else if (child->op_type == BF_OP_MULTIPLY && child->offset == 0) {
 			child->op_type = BF_OP_LOOP;
-			child->children.ops = NULL;
-			child->children.len = 0;
-			i--;
+			child->children = (bf_op_builder) {.arena = ops->arena};
+			list_modified(&list, pos);
 		} else if (child->op_type == BF_OP_ALTER && child->offset == 0) {
 			if (child->definitely_zero) {
 				child->op_type = BF_OP_SET;
-				i--;
-			} else if (move_addition(ops, i))
-				i--;
-		} else if (can_merge_set_ops(ops, i)) {
-			ssize_t old_offset = ops->ops[i - 1].offset;
-			ops->ops[i - 2].offset += child->offset + 1;
-			i--;
-			remove_bf_ops(ops, i, 2);
-			if (i < ops->len && ops->ops[i].op_type == BF_OP_ALTER) {
-				ops->ops[i].offset += old_offset;
+				list_modified(&list, pos);
+			} else {
+				size_t next_pos = list_next(&list, pos);
+				if (move_addition(&list, pos))
+					pos = next_pos;
+				else
+					pos = list_next(&list, pos);
+			}
+		} else if (can_merge_set_ops(&list, pos)) {
+			size_t alter_pos = list_prev(&list, pos), set_pos = list_prev(&list, alter_pos);
+			bf_op *alter = list_op(&list, alter_pos), *set = list_op(&list, set_pos);
+			ssize_t old_offset = alter->offset;
+			source_range old_source = alter->source;
+			set->offset += child->offset + 1;
+			set->source = source_range_union(set->source, child->source);
+			list_modified(&list, set_pos);
+
+			// The ALTER's move now comes after the merged SET
+			size_t after = list_remove(&list, pos);
+			if (after != NO_OP && list_op(&list, after)->op_type == BF_OP_ALTER) {
+				list_remove(&list, alter_pos);
+				list_op(&list, after)->offset += old_offset;
+				list_op(&list, after)->source = source_range_union(list_op(&list, after)->source, old_source);
+				if (after < list.indexed)
+					list.pos_before[after] -= old_offset;
+				list_modified(&list, after);
 			} else {
-				*insert_bf_ops(ops, i, 1) = (bf_op) {
+				*alter = (bf_op) {
 					.op_type = BF_OP_ALTER,
 					.offset = old_offset,
 					.amount = 0,
+					.source = old_source,
 				};
+				list_modified(&list, alter_pos);
 			}
-			i -= 2;
+			pos = set_pos;
 		} else if (loops_exactly_once(child)) {
-			remove_looping(ops, i--);
+			remove_looping(&list, pos);
+		} else {
+			pos = list_next(&list, pos);
 		}
 	}
+
+	list_compact(&list);
 }
 
-void optimize_loop(bf_op_builder *ops) {
+/*
+ * Turns loops which clear or move along cells until they reach a zero into
+ * single ops.  Each pass through [[-]>] clears a cell, then steps to the
+ * next, so all of the cells from the start to the first zero are cleared.
+ * Each pass through [[->+<]<] moves a cell one along, into the cell the pass
+ * before emptied, then steps back to the next, so it only stops at the first
+ * zero there was to start with, having shifted all the cells up to it.  That
+ * holds for any distance the cells move, so long as it's against the steps,
+ * which are one cell each, so that no cell is missed.
+ */
+static bool make_loop_into_run(bf_op *op) {
+	bf_op_builder *children = &op->children;
+	if (children->len < 2) return false;
+
+	bf_op *step = &children->ops[children->len - 1];
+	if (step->op_type != BF_OP_ALTER || step->amount != 0 || step->offset == 0) return false;
+
+	bf_op *clear = &children->ops[children->len - 2];
+	if (clear->op_type != BF_OP_SET || clear->amount != 0 || clear->offset != 0) return false;
+
+	ssize_t stride = step->offset, distance = 0;
+	if (children->len == 3) {
+		bf_op *move = &children->ops[0];
+		if (move->op_type != BF_OP_MULTIPLY || move->amount != 1) return false;
+		if (stride != 1 && stride != -1) return false;
+		if (move->offset == 0 || (move->offset > 0) == (stride > 0)) return false;
+		distance = move->offset;
+	} else if (children->len != 2) {
+		return false;
+	}
+
+	op->op_type = distance ? BF_OP_SHIFT_RUN : BF_OP_CLEAR_RUN;
+	op->offset = stride;
+	op->amount = 0;
+	op->factor = distance;
+	return true;
+}
+
+#ifdef FIXED_TAPE_SIZE
+// Widens low..high to take in the cells a run of ops reaches, from pos
+static void get_reach(bf_op_builder *ops, ssize_t pos, ssize_t *low, ssize_t *high) {
+	for (size_t i = 0; i < ops->len; i++) {
+		bf_op *op = &ops->ops[i];
+		switch (op->op_type) {
+			case BF_OP_LOOP:
+				get_reach(&op->children, pos, low, high);
+				continue;
+			case BF_OP_SKIP:
+			case BF_OP_CLEAR_RUN:
+			case BF_OP_SHIFT_RUN:
+				// The idioms don't see past these anyway
+				continue;
+			default:
+				break;
+		}
+		if (pos + get_min_offset(op) < *low) *low = pos + get_min_offset(op);
+		if (pos + get_max_offset(op) > *high) *high = pos + get_max_offset(op);
+		if (op->op_type == BF_OP_ALTER)
+			pos += op->offset;
+	}
+}
+
+/*
+ * Whether a loop reaches cells as far apart as the tape is long.  As the
+ * position wraps around, they're the same cell, which the idioms would take
+ * for two.
+ */
+static bool reaches_round_tape(bf_op *loop) {
+	ssize_t low = 0, high = 0;
+	get_reach(&loop->children, 0, &low, &high);
+	return (size_t)(high - low) >= FIXED_TAPE_CELLS;
+}
+#endif
+
+void optimize_loop(bf_op_builder *ops, bool idioms) {
 	bf_op *op = &ops->ops[ops->len - 1];
 
 	// Peephole optimizations that can't be done while initially building the loop's AST
-	peephole_optimize(&op->children, true);
+	peephole_optimize(&op->children, true, false);
 
 	// Find common types of loop
-	if (op->children.len == 1
+	if (!idioms) {
+		return;
+#ifdef FIXED_TAPE_SIZE
+	} else if (reaches_round_tape(op)) {
+		return;
+#endif
+	} else if (op->children.len == 1
 			&& op->children.ops[0].op_type == BF_OP_ALTER
 			&& op->children.ops[0].amount == 0) {
 		ssize_t offset = op->children.ops[0].offset;
-		free_bf_op_children(op);
 		op->op_type = BF_OP_SKIP;
 		op->offset = offset;
 	} else if (make_loop_into_multiply(ops)) {
 		return;
+	} else if (make_nest_into_products(op)) {
+		return;
+	} else if (make_loop_into_run(op)) {
+		return;
 	}
 }
 
 void optimize_root(bf_op_builder *ops) {
-	// We know the whole tape is zeros when the program starts
-	mark_as_zero(ops, 0, true);
-
-	// Run peephole optimizer (required for flattener to function at all)
-	peephole_optimize(ops, false);
+	// We know the whole tape is zeros when the program starts, and the
+	// peephole optimizer is required for the flattener to function at all
+	peephole_optimize(ops, false, true);
 }
 
 static bool directions_agree(ssize_t a, ssize_t b) {
@@ -401,10 +1038,14 @@ static bool directions_agree(ssize_t a, ssize_t b) {
 }
 
 static void make_bound_check(bf_op_builder *ops, size_t pos, ssize_t bound) {
-	*insert_bf_ops(ops, pos, 1) = (bf_op) {
+	bf_op *check = insert_bf_ops(ops, pos, 1);
+	*check = (bf_op) {
 		.op_type = BF_OP_BOUNDS_CHECK,
 		.offset = bound,
 	};
+	// Put it down to the code it is checking for
+	if (pos + 1 < ops->len)
+		check->source = check[1].source;
 }
 
 static size_t check_for_bound_check(bf_op_builder *ops_arr, size_t index, int direction) {
@@ -487,7 +1128,13 @@ static bool have_bound_at(bf_op_builder *arr, size_t where, int direction) {
 }
 #endif
 
-void add_bounds_checks(bf_op_builder *ops) {
+// Whether the op moves along the tape until it finds a zero, like a skip
+static bool stops_at_zero(bf_op *op) {
+	return op->op_type == BF_OP_SKIP || op->op_type == BF_OP_CLEAR_RUN || op->op_type == BF_OP_SHIFT_RUN;
+}
+
+// Adds the bounds checks to one builder, whose loops already have theirs
+static void add_bounds_checks_to(bf_op_builder *ops, bool is_root) {
 	assert(ops != NULL);
 	if (ops->len == 0)
 		return;
@@ -498,18 +1145,27 @@ void add_bounds_checks(bf_op_builder *ops) {
 
 	ssize_t curr_off_fwd = 0; // Current offset since last forwards uncertainty
 	ssize_t curr_off_bck = 0;
+
+	// Whether the last uncertainty was a skip, which may have left us outside
+	// of the checked area (as the end of a loop's body might have, going round)
+	bool skipped_forwards = !is_root, skipped_backwards = !is_root;
 	for (size_t pos = 0; pos < ops->len;) {
 		ssize_t max_bound = 0, min_bound = 0;
 
 		while (pos < ops->len) {
 			bf_op *op = &ops->ops[pos];
-			if (op->op_type == BF_OP_LOOP || op->op_type == BF_OP_SKIP)
+			if (op->op_type == BF_OP_SHIFT_RUN) {
+				// The first cell it moves lands past where it starts
+				if (curr_off_fwd + op->factor > max_bound) max_bound = curr_off_fwd + op->factor;
+				if (curr_off_bck + op->factor < min_bound) min_bound = curr_off_bck + op->factor;
+			}
+			if (op->op_type == BF_OP_LOOP || stops_at_zero(op))
 				break;
 
 			ssize_t high_bound = curr_off_fwd + get_max_offset(op);
 			if (high_bound > max_bound) max_bound = high_bound;
 
-			ssize_t low_bound = curr_off_bck + get_max_offset(op);
+			ssize_t low_bound = curr_off_bck + get_min_offset(op);
 			if (low_bound < min_bound) min_bound = low_bound;
 
 			curr_off_fwd += get_final_offset(op);
@@ -541,8 +1197,6 @@ void add_bounds_checks(bf_op_builder *ops) {
 		size_t this_op_pos = pos++;
 		bf_op *op = &ops->ops[this_op_pos];
 		if (op->op_type == BF_OP_LOOP) {
-			add_bounds_checks(&op->children);
-
 			// Serious hacks round 2: pull bounds checks from the beginning of the loop
 			loop_info info = get_loop_info(op);
 
@@ -553,14 +1207,18 @@ void add_bounds_checks(bf_op_builder *ops) {
 				if (last_certain_forwards > last_certain_backwards)
 					last_certain_forwards += shift;
 
-				curr_off_bck += info.offset_lower;
+				// The loop might not run at all
+				if (info.offset_lower < 0)
+					curr_off_bck += info.offset_lower;
 				if (curr_off_bck < 0) {
 					assert(check_for_bound_check(ops, last_certain_backwards, -1) != (size_t) -1);
 					assert(ops->ops[check_for_bound_check(ops, last_certain_backwards, -1)].offset <= curr_off_bck);
 				}
 			} else {
+				// It might have finished with a skip
 				last_certain_backwards = pos;
 				curr_off_bck = 0;
+				skipped_backwards = true;
 			}
 			assert(!have_bound_at(ops, last_certain_backwards - 1, -1));
 
@@ -571,7 +1229,8 @@ void add_bounds_checks(bf_op_builder *ops) {
 				if (last_certain_backwards > last_certain_forwards)
 					last_certain_backwards += shift;
 
-				curr_off_fwd += info.offset_upper;
+				if (info.offset_upper > 0)
+					curr_off_fwd += info.offset_upper;
 				if (curr_off_fwd > 0) {
 					assert(check_for_bound_check(ops, last_certain_forwards, 1) != (size_t) -1);
 					assert(ops->ops[check_for_bound_check(ops, last_certain_forwards, 1)].offset >= curr_off_fwd);
@@ -579,19 +1238,834 @@ void add_bounds_checks(bf_op_builder *ops) {
 			} else {
 				last_certain_forwards = pos;
 				curr_off_fwd = 0;
+				skipped_forwards = true;
 			}
 			assert(!have_bound_at(ops, last_certain_forwards - 1, 1));
-		} else if (op->op_type == BF_OP_SKIP) {
+		} else {
+			// The skip padding only covers a skip which starts inside the
+			// checked area, so one following another needs a check first
+			// (as do runs, which stop where a skip would)
 			if (op->offset > 0) {
+				if (skipped_forwards) {
+					size_t shift = reuse_or_make_bound_check(ops, last_certain_forwards, curr_off_fwd > 0 ? curr_off_fwd : 1, 1);
+					pos += shift;
+					if (last_certain_backwards > last_certain_forwards)
+						last_certain_backwards += shift;
+				}
 				last_certain_forwards = pos;
 				curr_off_fwd = 0;
+				skipped_forwards = true;
 			} else {
+				if (skipped_backwards) {
+					size_t shift = reuse_or_make_bound_check(ops, last_certain_backwards, curr_off_bck < 0 ? curr_off_bck : -1, -1);
+					pos += shift;
+					if (last_certain_forwards > last_certain_backwards)
+						last_certain_forwards += shift;
+				}
 				last_certain_backwards = pos;
 				curr_off_bck = 0;
+				skipped_backwards = true;
 			}
 		}
 	}
-	// Make this loop a little smaller
-	ops->alloc = ops->len;
-	ops->ops = realloc(ops->ops, ops->len * sizeof *ops->ops);
+}
+
+/*
+ * Lists the builder and all of the ones in the loops inside it, rather than
+ * finding them by recursion.  Every builder comes before the ones inside it,
+ * so going through the list in reverse does each one before anything moves
+ * the loop holding it.
+ */
+static bf_op_builder **list_builders(bf_op_builder *ops, size_t *count_out) {
+	size_t count = 0, alloc = 64;
+	bf_op_builder **builders = malloc(alloc * sizeof *builders);
+	builders[count++] = ops;
+
+	for (size_t i = 0; i < count; i++) {
+		bf_op_builder *builder = builders[i];
+		for (size_t j = 0; j < builder->len; j++) {
+			if (builder->ops[j].op_type != BF_OP_LOOP)
+				continue;
+			if (count == alloc) {
+				alloc *= 2;
+				builders = realloc(builders, alloc * sizeof *builders);
+			}
+			builders[count++] = &builder->ops[j].children;
+		}
+	}
+
+	*count_out = count;
+	return builders;
+}
+
+/*
+ * The loops are done before the builders containing them, so that their
+ * bounds checks can be pulled out.
+ */
+void add_bounds_checks(bf_op_builder *ops) {
+	size_t count;
+	bf_op_builder **builders = list_builders(ops, &count);
+	while (count--)
+		add_bounds_checks_to(builders[count], !count);
+	free(builders);
+}
+
+// How many adds and other ops a run can have before they move to the heap
+#define DEFER_FIXED_ADDS 32
+#define DEFER_FIXED_OPS 32
+
+typedef struct {
+	ssize_t offset;
+	cell_int amount;
+	source_range source;
+} deferred_add;
+
+static int compare_deferred_adds(void const *a, void const *b) {
+	ssize_t left = ((deferred_add const*)a)->offset, right = ((deferred_add const*)b)->offset;
+	return (left > right) - (left < right);
+}
+
+/*
+ * Sorts the adds by offset and merges the ones to the same cell, leaving out
+ * any which come to nothing.  Returns how many are left.
+ */
+static size_t merge_deferred_adds(deferred_add *adds, size_t count) {
+	qsort(adds, count, sizeof *adds, compare_deferred_adds);
+	size_t to = 0;
+	for (size_t i = 0; i < count;) {
+		deferred_add add = adds[i++];
+		for (; i < count && adds[i].offset == add.offset; i++) {
+			add.amount += adds[i].amount;
+			add.source = source_range_union(add.source, adds[i].source);
+		}
+		if (add.amount)
+			adds[to++] = add;
+	}
+	return to;
+}
+
+/*
+ * The op which does what the op does, from an offset from where it was.  The
+ * op is one which works on a single cell, which it keeps the plain form for
+ * when it ends up at offset 0, unless told to keep the offset form.
+ */
+static bf_op at_offset(bf_op const *op, ssize_t offset, bool keep_offset) {
+	bf_op moved = *op;
+	moved.offset = offset;
+	switch (op->op_type) {
+		case BF_OP_SET_AT:
+		case BF_OP_IN_AT:
+		case BF_OP_OUT_AT:
+			moved.offset += op->offset;
+			break;
+		default:
+			break;
+	}
+
+	bool plain = !moved.offset && !keep_offset;
+	switch (op->op_type) {
+		case BF_OP_SET:
+		case BF_OP_SET_AT:
+			moved.op_type = plain ? BF_OP_SET : BF_OP_SET_AT;
+			break;
+		case BF_OP_IN:
+		case BF_OP_IN_AT:
+			moved.op_type = plain ? BF_OP_IN : BF_OP_IN_AT;
+			break;
+		default:
+			moved.op_type = plain ? BF_OP_OUT : BF_OP_OUT_AT;
+			break;
+	}
+	return moved;
+}
+
+// Whether a run of ops with their moves deferred can take in the op
+static bool can_defer_past(bf_op_builder *ops, size_t i) {
+	switch (ops->ops[i].op_type) {
+		case BF_OP_ALTER:
+		case BF_OP_ADD_AT:
+		case BF_OP_SET_AT:
+		case BF_OP_IN:
+		case BF_OP_IN_AT:
+		case BF_OP_OUT:
+		case BF_OP_OUT_AT:
+		case BF_OP_WRITE_CONST:
+			return true;
+		case BF_OP_SET:
+			// The SET ending a run of MULTIPLYs is part of them, and has to stay
+			return ops->ops[i].offset == 0 && !(i && ops->ops[i - 1].op_type == BF_OP_MULTIPLY);
+		default:
+			return false;
+	}
+}
+
+/*
+ * Rewrites each run of ALTERs in the builder, along with the SETs, INs and
+ * OUTs of single cells among them, into ops at offsets from where the run
+ * starts, which don't move.  The adds between the other ops are made as
+ * ADD_ATs, in order of offset, before the next op which might read them.  The
+ * run's whole move comes last, as one ALTER which also does the add to the
+ * cell it ends up on.  Runs which would come out longer are left as they
+ * are.  Returns whether there were any runs to rewrite.
+ */
+static bool defer_moves_in(bf_op_builder *ops) {
+	deferred_add fixed_adds[DEFER_FIXED_ADDS];
+	deferred_add *adds = fixed_adds;
+	size_t adds_alloc = DEFER_FIXED_ADDS;
+	bf_op fixed_run[DEFER_FIXED_OPS];
+	bf_op *run = fixed_run;
+	size_t run_alloc = DEFER_FIXED_OPS;
+	bool changed = false;
+
+	size_t to = 0;
+	for (size_t from = 0; from < ops->len;) {
+		size_t end = from, alters = 0;
+		for (; end < ops->len && can_defer_past(ops, end); end++)
+			alters += ops->ops[end].op_type == BF_OP_ALTER;
+		if (alters < 2) {
+			do
+				ops->ops[to++] = ops->ops[from++];
+			while (from < end);
+			continue;
+		}
+
+		size_t count = 0, length = 0;
+		ssize_t pos = 0;
+		source_range move_source = {0};
+		for (size_t i = from; i <= end; i++) {
+			bf_op *op = i < end ? &ops->ops[i] : NULL;
+			if (op && (op->op_type == BF_OP_ALTER || op->op_type == BF_OP_ADD_AT)) {
+				ssize_t offset = pos + op->offset;
+				if (op->op_type == BF_OP_ALTER) {
+					pos = offset;
+					move_source = op->source;
+				}
+				if (!op->amount)
+					continue;
+				if (count == adds_alloc)
+					adds = grow_stack(adds, fixed_adds, &adds_alloc, sizeof *adds);
+				adds[count++] = (deferred_add) {.offset = offset, .amount = op->amount, .source = op->source};
+				continue;
+			}
+			if (op && op->op_type == BF_OP_WRITE_CONST) {
+				if (length == run_alloc)
+					run = grow_stack(run, fixed_run, &run_alloc, sizeof *run);
+				run[length++] = *op;
+				continue;
+			}
+
+			// The rest might read the cells added to, so the adds so far go first
+			count = merge_deferred_adds(adds, count);
+			deferred_add final = {.offset = pos, .source = move_source};
+			for (size_t j = 0; j < count; j++) {
+				if (!op && adds[j].offset == pos) {
+					final.amount = adds[j].amount;
+					final.source = source_range_union(final.source, adds[j].source);
+					continue;
+				}
+				if (length == run_alloc)
+					run = grow_stack(run, fixed_run, &run_alloc, sizeof *run);
+				run[length++] = (bf_op) {
+					.op_type = BF_OP_ADD_AT,
+					.offset = adds[j].offset,
+					.amount = adds[j].amount,
+					.source = adds[j].source,
+				};
+			}
+			count = 0;
+
+			if (length == run_alloc)
+				run = grow_stack(run, fixed_run, &run_alloc, sizeof *run);
+			if (!op) {
+				if (final.offset || final.amount) {
+					run[length++] = (bf_op) {
+						.op_type = BF_OP_ALTER,
+						.offset = final.offset,
+						.amount = final.amount,
+						.source = final.source,
+					};
+				}
+				break;
+			}
+
+			// A SET straight after a MULTIPLY would be taken as part of it
+			bool after_multiply = !length && to && ops->ops[to - 1].op_type == BF_OP_MULTIPLY;
+			run[length++] = at_offset(op, pos, after_multiply);
+		}
+
+		if (length <= end - from) {
+			memcpy(&ops->ops[to], run, length * sizeof *run);
+			to += length;
+			from = end;
+			changed = true;
+		} else {
+			while (from < end)
+				ops->ops[to++] = ops->ops[from++];
+		}
+	}
+	ops->len = to;
+
+	if (adds != fixed_adds)
+		free(adds);
+	if (run != fixed_run)
+		free(run);
+	return changed;
+}
+
+/*
+ * Saves the interpreters updating the data pointer for every op in a run of
+ * pointer moves, adds and single cell ops.  The loops are done first, like add_bounds_checks
+ * does, so that compacting a builder can't move a loop which is still to do.
+ * Returns whether it changed the tree.
+ */
+bool defer_moves(bf_op_builder *ops) {
+	size_t count;
+	bool changed = false;
+	bf_op_builder **builders = list_builders(ops, &count);
+	while (count)
+		changed |= defer_moves_in(builders[--count]);
+	free(builders);
+	return changed;
+}
+
+// How many cells the dead store pass keeps track of at once
+#define LIVENESS_CELLS 64
+
+/*
+ * The cells which are dead at a point in a builder, at offsets from the data
+ * pointer there.  Either the listed cells are dead and the rest live, or, at
+ * the end of the program, the listed cells are live and the rest dead.
+ * Running out of room only ever makes cells live.
+ */
+typedef struct {
+	bool listed_live;
+	size_t count;
+	ssize_t offsets[LIVENESS_CELLS];
+} liveness;
+
+static bool is_dead(liveness *cells, ssize_t offset) {
+	for (size_t i = 0; i < cells->count; i++) {
+		if (cells->offsets[i] == offset)
+			return !cells->listed_live;
+	}
+	return cells->listed_live;
+}
+
+static void make_all_live(liveness *cells) {
+	cells->listed_live = false;
+	cells->count = 0;
+}
+
+static void set_dead(liveness *cells, ssize_t offset, bool dead) {
+	bool listed = dead != cells->listed_live;
+	for (size_t i = 0; i < cells->count; i++) {
+		if (cells->offsets[i] != offset)
+			continue;
+		if (!listed)
+			cells->offsets[i] = cells->offsets[--cells->count];
+		return;
+	}
+
+	if (!listed)
+		return;
+	if (cells->count < LIVENESS_CELLS)
+		cells->offsets[cells->count++] = offset;
+	else if (cells->listed_live)
+		make_all_live(cells);
+}
+
+/*
+ * Goes back over the op, from the cells which are dead after it to the ones
+ * which are dead before it.  Stores to dead cells are taken out, leaving an
+ * op which does nothing as an ALTER by 0 for the caller to remove.  Returns
+ * whether anything was taken out.
+ */
+static bool remove_dead_store(bf_op *op, bool after_multiply, liveness *cells) {
+	bool changed = false;
+	switch (op->op_type) {
+		case BF_OP_ALTER:
+			if (op->amount && is_dead(cells, 0)) {
+				op->amount = 0;
+				changed = true;
+			}
+			if (op->amount)
+				set_dead(cells, 0, false);
+			// Where the pointer ends up only matters to the cells read after it
+			if (cells->listed_live && !cells->count && op->offset) {
+				op->offset = 0;
+				changed = true;
+			}
+			for (size_t i = 0; i < cells->count; i++)
+				cells->offsets[i] += op->offset;
+			break;
+
+		case BF_OP_ADD_AT:
+			if (is_dead(cells, op->offset)) {
+				*op = (bf_op) {.op_type = BF_OP_ALTER, .source = op->source};
+				changed = true;
+			} else {
+				set_dead(cells, op->offset, false);
+			}
+			break;
+
+		case BF_OP_SET: {
+			// The SET ending a run of MULTIPLYs is part of them, and has to stay
+			ssize_t last = op->offset;
+			while (last >= (after_multiply ? 1 : 0) && is_dead(cells, last))
+				last--;
+			if (last < 0) {
+				*op = (bf_op) {.op_type = BF_OP_ALTER, .source = op->source};
+				changed = true;
+				break;
+			}
+			changed |= op->offset != last;
+			op->offset = last;
+			for (ssize_t i = 0; i <= last; i++)
+				set_dead(cells, i, true);
+			break;
+		}
+
+		case BF_OP_MULTIPLY:
+			if (is_dead(cells, op->offset)) {
+				*op = (bf_op) {.op_type = BF_OP_ALTER, .source = op->source};
+				changed = true;
+			} else {
+				set_dead(cells, op->offset, false);
+				set_dead(cells, 0, false);
+			}
+			break;
+
+		case BF_OP_PRODUCT:
+			if (is_dead(cells, op->offset)) {
+				*op = (bf_op) {.op_type = BF_OP_ALTER, .source = op->source};
+				changed = true;
+			} else {
+				set_dead(cells, op->offset, false);
+				set_dead(cells, op->factor, false);
+				set_dead(cells, 0, false);
+			}
+			break;
+
+		case BF_OP_SET_AT:
+			if (is_dead(cells, op->offset)) {
+				*op = (bf_op) {.op_type = BF_OP_ALTER, .source = op->source};
+				changed = true;
+			} else {
+				set_dead(cells, op->offset, true);
+			}
+			break;
+
+		case BF_OP_IN:
+			set_dead(cells, 0, true);
+			break;
+
+		case BF_OP_IN_AT:
+			set_dead(cells, op->offset, true);
+			break;
+
+		case BF_OP_OUT_AT:
+			set_dead(cells, op->offset, false);
+			break;
+
+		case BF_OP_OUT:
+		case BF_OP_DIVIDE:
+			// A DIVIDE might never stop, so it stays whatever it leaves behind
+			set_dead(cells, 0, false);
+			break;
+
+		case BF_OP_WRITE_CONST:
+		case BF_OP_BOUNDS_CHECK:
+			break;
+
+		case BF_OP_SKIP:
+		case BF_OP_CLEAR_RUN:
+		case BF_OP_SHIFT_RUN:
+			make_all_live(cells);
+			break;
+
+		case BF_OP_LOOP: {
+			loop_info info = get_loop_info(op);
+			if (info.uncertain_forwards || info.uncertain_backwards || cells->listed_live) {
+				make_all_live(cells);
+				break;
+			}
+
+			// The loop might not run at all, so it can only make cells live
+			for (size_t i = 0; i < cells->count;) {
+				ssize_t offset = cells->offsets[i];
+				if (offset == 0 || offset_might_be_accessed(offset, &op->children, 0, op->children.len, true, true))
+					cells->offsets[i] = cells->offsets[--cells->count];
+				else
+					i++;
+			}
+			break;
+		}
+
+		default:
+			assert(!"Unexpected opcode");
+			make_all_live(cells);
+			break;
+	}
+	return changed;
+}
+
+/*
+ * Works back from the end of the builder, taking out stores to cells which
+ * are overwritten before anything reads them.  Nothing after the end of the
+ * program reads the tape, but the end of a loop's body goes back to its test,
+ * and maybe round again, so everything is live there.  Returns whether it
+ * took anything out.
+ */
+static bool remove_dead_stores_in(bf_op_builder *ops, bool is_root) {
+	liveness cells = {.listed_live = is_root};
+	bool changed = false;
+
+	// A dead SET ending a run of MULTIPLYs can only go if they all do
+	size_t dead_set = SIZE_MAX;
+	bool multiplies_kept = false;
+
+	for (size_t i = ops->len; i--;) {
+		bf_op *op = &ops->ops[i];
+		bool after_multiply = i && ops->ops[i - 1].op_type == BF_OP_MULTIPLY;
+		bool was_dead = is_dead(&cells, 0);
+		changed |= remove_dead_store(op, after_multiply, &cells);
+
+		if (op->op_type == BF_OP_SET && after_multiply && was_dead && op->offset == 0) {
+			dead_set = i;
+			multiplies_kept = false;
+		} else if (op->op_type == BF_OP_MULTIPLY) {
+			multiplies_kept = true;
+		}
+		if (dead_set != SIZE_MAX && !after_multiply) {
+			// That was the first of the run
+			if (!multiplies_kept) {
+				ops->ops[dead_set] = (bf_op) {.op_type = BF_OP_ALTER, .source = ops->ops[dead_set].source};
+				changed = true;
+			}
+			dead_set = SIZE_MAX;
+		}
+
+		// What the op knew about its cell doesn't hold if stores to it went
+		if (is_dead(&cells, 0))
+			op->definitely_zero = op->definitely_nonzero = false;
+	}
+
+	// Moves left behind by taking out adds are merged, as the peephole optimizer would
+	size_t to = 0;
+	for (size_t from = 0; from < ops->len; from++) {
+		bf_op *op = &ops->ops[from], *prev = to ? &ops->ops[to - 1] : NULL;
+		if (is_redundant_alter(op))
+			continue;
+		if (!prev || op->op_type != BF_OP_ALTER || prev->op_type != BF_OP_ALTER || (prev->amount && op->offset)) {
+			ops->ops[to++] = *op;
+			continue;
+		}
+
+		prev->offset += op->offset;
+		prev->amount += op->amount;
+		prev->source = source_range_union(prev->source, op->source);
+		if (is_redundant_alter(prev))
+			to--;
+	}
+	changed |= to != ops->len;
+	ops->len = to;
+	return changed;
+}
+
+/*
+ * Takes out stores which are never read.  The loops are done first, like
+ * add_bounds_checks does, so that compacting a builder can't move a loop
+ * which is still to do.  Returns whether it changed the tree.
+ */
+bool remove_dead_stores(bf_op_builder *ops) {
+	size_t count;
+	bool changed = false;
+	bf_op_builder **builders = list_builders(ops, &count);
+	while (count--)
+		changed |= remove_dead_stores_in(builders[count], !count);
+	free(builders);
+	return changed;
+}
+
+// How many cells the constant output pass keeps track of at once
+#define KNOWN_CELLS 64
+
+typedef struct {
+	ssize_t offset;
+	cell_int value;
+	bool known;
+} known_cell;
+
+/*
+ * The values of cells at offsets from the data pointer, which are known
+ * while compiling.  Cells which aren't listed are known to be zero until
+ * anything moves into the unknown, as at the start of the program, and not
+ * known at all after.  Running out of room only ever forgets values.
+ */
+typedef struct {
+	bool unlisted_zero;
+	size_t count;
+	known_cell cells[KNOWN_CELLS];
+} known_cells;
+
+static bool get_known(known_cells *known, ssize_t offset, cell_int *value) {
+	for (size_t i = 0; i < known->count; i++) {
+		if (known->cells[i].offset == offset) {
+			*value = known->cells[i].value;
+			return known->cells[i].known;
+		}
+	}
+	*value = 0;
+	return known->unlisted_zero;
+}
+
+static void set_known(known_cells *known, ssize_t offset, bool is_known, cell_int value) {
+	for (size_t i = 0; i < known->count; i++) {
+		if (known->cells[i].offset == offset) {
+			known->cells[i] = (known_cell) {.offset = offset, .value = value, .known = is_known};
+			return;
+		}
+	}
+
+	if (!is_known && !known->unlisted_zero)
+		return;
+	if (known->count < KNOWN_CELLS)
+		known->cells[known->count++] = (known_cell) {.offset = offset, .value = value, .known = is_known};
+	else
+		// The cell can't be listed, so it mustn't be taken for a zero either
+		known->unlisted_zero = false;
+}
+
+static void forget_known(known_cells *known) {
+	known->unlisted_zero = false;
+	known->count = 0;
+}
+
+// Goes forward over an op, other than an output of a known cell
+static void step_known(known_cells *known, bf_op *op) {
+	cell_int value, factor, target;
+	switch (op->op_type) {
+		case BF_OP_ALTER:
+			for (size_t i = 0; i < known->count; i++)
+				known->cells[i].offset -= op->offset;
+			if (op->amount) {
+				bool is_known = get_known(known, 0, &value);
+				set_known(known, 0, is_known, value + op->amount);
+			}
+			break;
+
+		case BF_OP_ADD_AT: {
+			bool is_known = get_known(known, op->offset, &value);
+			set_known(known, op->offset, is_known, value + op->amount);
+			break;
+		}
+
+		case BF_OP_SET:
+			for (ssize_t i = 0; i <= op->offset; i++)
+				set_known(known, i, true, op->amount);
+			break;
+
+		case BF_OP_SET_AT:
+			set_known(known, op->offset, true, op->amount);
+			break;
+
+		case BF_OP_MULTIPLY: {
+			bool is_known = get_known(known, 0, &value) & get_known(known, op->offset, &target);
+			set_known(known, op->offset, is_known, target + multiply_cells(value, op->amount, 1));
+			break;
+		}
+
+		case BF_OP_PRODUCT: {
+			bool is_known = get_known(known, 0, &value) & get_known(known, op->factor, &factor)
+				& get_known(known, op->offset, &target);
+			set_known(known, op->offset, is_known, target + multiply_cells(value, factor, op->amount));
+			break;
+		}
+
+		case BF_OP_DIVIDE:
+		case BF_OP_IN:
+			set_known(known, 0, false, 0);
+			break;
+
+		case BF_OP_IN_AT:
+			set_known(known, op->offset, false, 0);
+			break;
+
+		case BF_OP_OUT:
+		case BF_OP_OUT_AT:
+		case BF_OP_WRITE_CONST:
+		case BF_OP_BOUNDS_CHECK:
+			break;
+
+		case BF_OP_LOOP: {
+			loop_info info = get_loop_info(op);
+			if (info.uncertain_forwards || info.uncertain_backwards) {
+				forget_known(known);
+			} else {
+				// The cells the loop leaves alone keep their values
+				known->unlisted_zero = false;
+				for (size_t i = 0; i < known->count;) {
+					if (offset_might_be_accessed(known->cells[i].offset, &op->children, 0, op->children.len, false, true))
+						known->cells[i] = known->cells[--known->count];
+					else
+						i++;
+				}
+			}
+			set_known(known, 0, true, 0);
+			break;
+		}
+
+		case BF_OP_SKIP:
+		case BF_OP_CLEAR_RUN:
+		case BF_OP_SHIFT_RUN:
+			forget_known(known);
+			set_known(known, 0, true, 0);
+			break;
+
+		default:
+			assert(!"Unexpected opcode");
+			forget_known(known);
+			break;
+	}
+}
+
+// Whether the op can be run between outputs which are put together, without being seen to
+static bool is_quiet(bf_op *op) {
+	switch (op->op_type) {
+		case BF_OP_ALTER:
+		case BF_OP_ADD_AT:
+		case BF_OP_SET:
+		case BF_OP_SET_AT:
+		case BF_OP_MULTIPLY:
+		case BF_OP_PRODUCT:
+		case BF_OP_BOUNDS_CHECK:
+			return true;
+		default:
+			return false;
+	}
+}
+
+/*
+ * Puts together the output from the first OUT of a run onwards into one
+ * WRITE_CONST, in place of that OUT.  The rest of the outputs in the run
+ * are left as ALTERs by 0 for the caller to remove.
+ */
+static void close_known_output(bf_op_builder *ops, size_t first, size_t last, char const *text, size_t length) {
+	source_range source = ops->ops[first].source;
+	for (size_t i = first + 1; i <= last; i++) {
+		bf_op *op = &ops->ops[i];
+		if (op->op_type != BF_OP_OUT && op->op_type != BF_OP_OUT_AT && op->op_type != BF_OP_WRITE_CONST)
+			continue;
+		source = source_range_union(source, op->source);
+		*op = (bf_op) {.op_type = BF_OP_ALTER, .source = op->source};
+	}
+
+	char *copy = bf_arena_alloc(ops->arena, length);
+	memcpy(copy, text, length);
+	ops->ops[first] = (bf_op) {
+		.op_type = BF_OP_WRITE_CONST,
+		.text = copy,
+		.text_length = length,
+		.source = source,
+	};
+}
+
+/*
+ * Works forward through the builder, keeping track of which cells' values
+ * are known, and turns the OUTs of known cells into WRITE_CONSTs.  Outputs
+ * with nothing but quiet ops between them are written all at once, where
+ * the first of them was.  The cells they came from are still written to,
+ * unless nothing else reads them, when remove_dead_stores takes them out.
+ * Returns whether there were any to write.
+ */
+static bool write_known_output_in(bf_op_builder *ops, bool is_root) {
+	known_cells known = {.unlisted_zero = is_root};
+	char *text = NULL;
+	size_t length = 0, alloc = 0, first = 0, last = 0;
+	bool in_run = false, changed = false;
+
+	for (size_t i = 0; i < ops->len; i++) {
+		bf_op *op = &ops->ops[i];
+		cell_int value;
+		char const *out = NULL;
+		size_t out_length = 0;
+		char c;
+		bool is_out = op->op_type == BF_OP_OUT || op->op_type == BF_OP_OUT_AT;
+		if (is_out && get_known(&known, op->op_type == BF_OP_OUT_AT ? op->offset : 0, &value)) {
+			c = (char)value;
+			out = &c;
+			out_length = 1;
+		} else if (op->op_type == BF_OP_WRITE_CONST) {
+			out = op->text;
+			out_length = op->text_length;
+		}
+
+		if (out) {
+			if (!in_run) {
+				in_run = true;
+				first = i;
+				length = 0;
+			}
+			last = i;
+			if (length + out_length > alloc) {
+				alloc = alloc ? alloc : 64;
+				while (length + out_length > alloc)
+					alloc *= 2;
+				text = realloc(text, alloc);
+			}
+			memcpy(text + length, out, out_length);
+			length += out_length;
+			continue;
+		}
+
+		if (in_run && !is_quiet(op)) {
+			if (last != first || ops->ops[first].op_type != BF_OP_WRITE_CONST) {
+				close_known_output(ops, first, last, text, length);
+				changed = true;
+			}
+			in_run = false;
+		}
+		step_known(&known, op);
+	}
+	if (in_run && (last != first || ops->ops[first].op_type != BF_OP_WRITE_CONST)) {
+		close_known_output(ops, first, last, text, length);
+		changed = true;
+	}
+	free(text);
+
+	if (!changed)
+		return false;
+	size_t to = 0;
+	for (size_t from = 0; from < ops->len; from++) {
+		if (!is_redundant_alter(&ops->ops[from]))
+			ops->ops[to++] = ops->ops[from];
+	}
+	ops->len = to;
+	return true;
+}
+
+/*
+ * Writes output which is known while compiling as constant strings.  The
+ * loops are done first, like add_bounds_checks does, so that compacting a
+ * builder can't move a loop which is still to do.  Returns whether it changed
+ * the tree.
+ */
+bool write_known_output(bf_op_builder *ops) {
+	size_t count;
+	bool changed = false;
+	bf_op_builder **builders = list_builders(ops, &count);
+	while (count--)
+		changed |= write_known_output_in(builders[count], !count);
+	free(builders);
+	return changed;
+}
+
+// How many ops there are in the tree, in loops and all
+size_t count_bf_ops(bf_op_builder *ops) {
+	size_t count, total = 0;
+	bf_op_builder **builders = list_builders(ops, &count);
+	for (size_t i = 0; i < count; i++)
+		total += builders[i]->len;
+	free(builders);
+	return total;
 }
@@ -5,7 +5,11 @@
 #include "parser.h"
 
 void optimize_root(bf_op_builder *ops);
-void optimize_loop(bf_op_builder *ops);
+void optimize_loop(bf_op_builder *ops, bool idioms);
 void add_bounds_checks(bf_op_builder *ops);
+bool defer_moves(bf_op_builder *ops);
+bool remove_dead_stores(bf_op_builder *ops);
+bool write_known_output(bf_op_builder *ops);
+size_t count_bf_ops(bf_op_builder *ops);
 
 #endif
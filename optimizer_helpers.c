@@ -1,10 +1,17 @@
 #include <assert.h>
+#include <stdint.h>
 #include "optimizer_helpers.h"
 
+// How deep loops can nest before these walks' stacks move to the heap
+#define LOOP_INFO_STACK_FIXED 32
+#define ACCESS_STACK_FIXED 16
+
 bool ensures_zero(bf_op const *op) {
 	switch (op->op_type) {
 		case BF_OP_LOOP:
 		case BF_OP_SKIP:
+		case BF_OP_CLEAR_RUN:
+		case BF_OP_SHIFT_RUN:
 			return true;
 		case BF_OP_SET:
 			return op->amount == 0;
@@ -26,13 +33,24 @@ bool writes_cell(bf_op const *op) {
 	switch (op->op_type) {
 		case BF_OP_ALTER:
 			return op->amount != 0;
+		case BF_OP_ADD_AT:
+			return op->offset == 0 && op->amount != 0;
+		case BF_OP_SET_AT:
+		case BF_OP_IN_AT:
+			return op->offset == 0;
 		case BF_OP_LOOP:
 		case BF_OP_MULTIPLY:
+		case BF_OP_PRODUCT:
+		case BF_OP_DIVIDE:
 		case BF_OP_IN:
 		case BF_OP_SET:
+		case BF_OP_CLEAR_RUN:
+		case BF_OP_SHIFT_RUN:
 			return true;
 		case BF_OP_OUT:
+		case BF_OP_OUT_AT:
 		case BF_OP_SKIP:
+		case BF_OP_WRITE_CONST:
 			return false;
 		default:
 			assert(!"Unexpected opcode");
@@ -43,6 +61,8 @@ bool writes_cell(bf_op const *op) {
 bool moves_tape(bf_op *op) {
 	switch (op->op_type) {
 		case BF_OP_SKIP:
+		case BF_OP_CLEAR_RUN:
+		case BF_OP_SHIFT_RUN:
 			return true;
 		case BF_OP_ALTER:
 			return op->offset != 0;
@@ -54,6 +74,13 @@ bool moves_tape(bf_op *op) {
 		case BF_OP_OUT:
 		case BF_OP_SET:
 		case BF_OP_MULTIPLY:
+		case BF_OP_PRODUCT:
+		case BF_OP_DIVIDE:
+		case BF_OP_ADD_AT:
+		case BF_OP_SET_AT:
+		case BF_OP_IN_AT:
+		case BF_OP_OUT_AT:
+		case BF_OP_WRITE_CONST:
 			return false;
 		default:
 			assert(!"Unexpected opcode");
@@ -65,7 +92,11 @@ bool expects_nonzero(bf_op *op) {
 	switch (op->op_type) {
 		case BF_OP_LOOP:
 		case BF_OP_SKIP:
+		case BF_OP_CLEAR_RUN:
+		case BF_OP_SHIFT_RUN:
 		case BF_OP_MULTIPLY:
+		case BF_OP_PRODUCT:
+		case BF_OP_DIVIDE:
 			return true;
 		case BF_OP_SET:
 			// If it's already 0, this SET wanted to change something from
@@ -81,6 +112,8 @@ ssize_t get_final_offset(bf_op *op) {
 	switch (op->op_type) {
 		case BF_OP_LOOP:
 		case BF_OP_SKIP:
+		case BF_OP_CLEAR_RUN:
+		case BF_OP_SHIFT_RUN:
 			assert(!"No way to get the offset of this opcode");  // White lie
 			return 0;
 		case BF_OP_ALTER:
@@ -90,6 +123,13 @@ ssize_t get_final_offset(bf_op *op) {
 		case BF_OP_OUT:
 		case BF_OP_SET:
 		case BF_OP_MULTIPLY:
+		case BF_OP_PRODUCT:
+		case BF_OP_DIVIDE:
+		case BF_OP_ADD_AT:
+		case BF_OP_SET_AT:
+		case BF_OP_IN_AT:
+		case BF_OP_OUT_AT:
+		case BF_OP_WRITE_CONST:
 			return 0;
 		default:
 			assert(!"Unexpected opcode");
@@ -101,6 +141,8 @@ ssize_t get_max_offset(bf_op *op) {
 	switch (op->op_type) {
 		case BF_OP_LOOP:
 		case BF_OP_SKIP:
+		case BF_OP_CLEAR_RUN:
+		case BF_OP_SHIFT_RUN:
 			assert(!"No way to get the offset of this opcode");
 			return 0;
 		case BF_OP_ALTER:
@@ -108,14 +150,25 @@ ssize_t get_max_offset(bf_op *op) {
 		case BF_OP_BOUNDS_CHECK:
 		case BF_OP_IN:
 		case BF_OP_OUT:
+		case BF_OP_DIVIDE:
+		case BF_OP_WRITE_CONST:
 			return 0;
 		case BF_OP_SET:
 			return op->offset;
 		case BF_OP_MULTIPLY:
+		case BF_OP_ADD_AT:
+		case BF_OP_SET_AT:
+		case BF_OP_IN_AT:
+		case BF_OP_OUT_AT:
 			if (op->offset > 0)
 				return op->offset;
 			else
 				return 0;
+		case BF_OP_PRODUCT:
+			if (op->offset > 0 || op->factor > 0)
+				return op->offset > op->factor ? op->offset : op->factor;
+			else
+				return 0;
 		default:
 			assert(!"Unexpected opcode");
 			return 0;
@@ -126,6 +179,8 @@ ssize_t get_min_offset(bf_op *op) {
 	switch (op->op_type) {
 		case BF_OP_LOOP:
 		case BF_OP_SKIP:
+		case BF_OP_CLEAR_RUN:
+		case BF_OP_SHIFT_RUN:
 			assert(!"No way to get the offset of this opcode");
 			return 0;
 		case BF_OP_ALTER:
@@ -133,14 +188,25 @@ ssize_t get_min_offset(bf_op *op) {
 		case BF_OP_BOUNDS_CHECK:
 		case BF_OP_IN:
 		case BF_OP_OUT:
+		case BF_OP_DIVIDE:
+		case BF_OP_WRITE_CONST:
 			return 0;
 		case BF_OP_SET:
 			return op->offset;
 		case BF_OP_MULTIPLY:
+		case BF_OP_ADD_AT:
+		case BF_OP_SET_AT:
+		case BF_OP_IN_AT:
+		case BF_OP_OUT_AT:
 			if (op->offset < 0)
 				return op->offset;
 			else
 				return 0;
+		case BF_OP_PRODUCT:
+			if (op->offset < 0 || op->factor < 0)
+				return op->offset < op->factor ? op->offset : op->factor;
+			else
+				return 0;
 		default:
 			assert(!"Unexpected opcode");
 			return 0;
@@ -161,110 +227,210 @@ static bool loops_once_at_most(bf_op *loop) {
 	return false;
 }
 
+/*
+ * Adds a child of a loop to its info.  Any loop among them must have had its
+ * own info worked out already.  Returns false once nothing else can change.
+ */
+static bool add_child_info(loop_info *restrict info, bf_op *restrict child) {
+	if (child->op_type == BF_OP_ALTER) {
+		if (!info->inner_uncertain_backwards)
+			info->offset_lower += child->offset;
+		if (!info->inner_uncertain_forwards)
+			info->offset_upper += child->offset;
+	} else if (child->op_type == BF_OP_SKIP || child->op_type == BF_OP_CLEAR_RUN || child->op_type == BF_OP_SHIFT_RUN) {
+		assert(child->offset != 0);
+		if (child->offset > 0) {
+			info->inner_uncertain_forwards = true;
+		} else {
+			info->inner_uncertain_backwards = true;
+		}
+
+		if (info->inner_uncertain_forwards && info->inner_uncertain_backwards) return false;
+	} else if (child->op_type == BF_OP_LOOP) {
+		assert(child->info.calculated);
+		loop_info child_info = child->info;
+		if (child_info.loops_once_at_most) {
+			if (child_info.inner_uncertain_forwards) {
+				info->inner_uncertain_forwards = true;
+			} else if (child_info.offset_upper > 0) {
+				info->offset_upper += child_info.offset_upper;
+			}
+			if (child_info.inner_uncertain_backwards) {
+				info->inner_uncertain_backwards = true;
+			} else if (child_info.offset_lower < 0) {
+				info->offset_lower += child_info.offset_lower;
+			}
+		} else {
+			info->inner_uncertain_forwards  |= child_info.uncertain_forwards;
+			info->inner_uncertain_backwards |= child_info.uncertain_backwards;
+		}
+
+		if (info->uncertain_forwards && info->uncertain_backwards) return false;
+	}
+	return true;
+}
+
+typedef struct {
+	bf_op *op;
+	loop_info info;  // So far
+	size_t next_child;
+} loop_info_frame;
+
+/*
+ * The info of a loop depends on that of the loops inside it, which are worked
+ * out first on an explicit stack, so that deep nesting can't overflow the
+ * real one.
+ */
 loop_info get_loop_info(bf_op *restrict op) {
 	assert(op != NULL);
 	assert(op->op_type == BF_OP_LOOP);
 	assert(op->children.ops != NULL || op->children.len == 0);
 
-	loop_info info = op->info;
-
-	if (info.calculated)
-		return info;
-
-	for (size_t i = 0; i < op->children.len; i++) {
-		bf_op *child = &op->children.ops[i];
-		if (child->op_type == BF_OP_ALTER) {
-			if (!info.inner_uncertain_backwards)
-				info.offset_lower += child->offset;
-			if (!info.inner_uncertain_forwards)
-				info.offset_upper += child->offset;
-		} else if (child->op_type == BF_OP_SKIP) {
-			assert(child->offset != 0);
-			if (child->offset > 0) {
-				info.inner_uncertain_forwards = true;
-			} else {
-				info.inner_uncertain_backwards = true;
-			}
+	if (op->info.calculated)
+		return op->info;
 
-			if (info.inner_uncertain_forwards && info.inner_uncertain_backwards) break;
-		} else if (child->op_type == BF_OP_LOOP) {
-			loop_info child_info = get_loop_info(child);
-			if (child_info.loops_once_at_most) {
-				if (child_info.inner_uncertain_forwards) {
-					info.inner_uncertain_forwards = true;
-				} else if (child_info.offset_upper > 0) {
-					info.offset_upper += child_info.offset_upper;
-				}
-				if (child_info.inner_uncertain_backwards) {
-					info.inner_uncertain_backwards = true;
-				} else if (child_info.offset_lower < 0) {
-					info.offset_lower += child_info.offset_lower;
-				}
-			} else {
-				info.inner_uncertain_forwards  |= child_info.uncertain_forwards;
-				info.inner_uncertain_backwards |= child_info.uncertain_backwards;
+	loop_info_frame fixed[LOOP_INFO_STACK_FIXED];
+	loop_info_frame *stack = fixed;
+	size_t depth = 0, alloc = LOOP_INFO_STACK_FIXED;
+	stack[depth++] = (loop_info_frame) {.op = op, .info = op->info};
+
+	while (depth) {
+		loop_info_frame *frame = &stack[depth - 1];
+		bf_op *loop = frame->op;
+		if (frame->next_child < loop->children.len) {
+			bf_op *child = &loop->children.ops[frame->next_child];
+			if (child->op_type == BF_OP_LOOP && !child->info.calculated) {
+				if (depth == alloc)
+					stack = grow_stack(stack, fixed, &alloc, sizeof *stack);
+				stack[depth++] = (loop_info_frame) {.op = child, .info = child->info};
+				continue;
 			}
 
-			if (info.uncertain_forwards && info.uncertain_backwards) break;
+			if (add_child_info(&frame->info, child))
+				frame->next_child++;
+			else
+				frame->next_child = loop->children.len;
+			continue;
 		}
-	}
 
-	info.loops_once_at_most = loops_once_at_most(op);
+		loop_info info = frame->info;
+		info.loops_once_at_most = loops_once_at_most(loop);
+
+		info.uncertain_forwards = info.offset_upper > 0 || info.inner_uncertain_forwards;
+		info.uncertain_backwards = info.offset_lower < 0 || info.inner_uncertain_backwards;
+		info.calculated = true;
+		loop->info = info;
+		depth--;
+	}
 
-	info.uncertain_forwards = info.offset_upper > 0 || info.inner_uncertain_forwards;
-	info.uncertain_backwards = info.offset_lower < 0 || info.inner_uncertain_backwards;
-	info.calculated = true;
-	op->info = info;
-	return info;
+	if (stack != fixed)
+		free(stack);
+	return op->info;
 }
 
+typedef struct {
+	bf_op_builder *arr;
+	size_t pos, end;
+	ssize_t offset;
+} access_frame;
+
+/*
+ * Loops are looked inside on an explicit stack, continuing with the ops after
+ * one once everything in it has been checked.
+ */
 bool offset_might_be_accessed(ssize_t offset, bf_op_builder *restrict arr, size_t start, size_t end, bool include_reads, bool include_writes) {
 	assert(end <= arr->len);
 	assert(include_writes || include_reads);
 
-	for (size_t pos = start; pos < end; pos++) {
-		bf_op *op = &arr->ops[pos];
+	access_frame fixed[ACCESS_STACK_FIXED];
+	access_frame *stack = fixed;
+	size_t depth = 0, alloc = ACCESS_STACK_FIXED;
+	stack[depth++] = (access_frame) {.arr = arr, .pos = start, .end = end, .offset = offset};
+	bool accessed = false;
+
+	while (depth && !accessed) {
+		access_frame *frame = &stack[depth - 1];
+		if (frame->pos == frame->end) {
+			depth--;
+			continue;
+		}
+
+		bf_op *op = &frame->arr->ops[frame->pos++];
 		switch (op->op_type) {
 			case BF_OP_IN:
-				if (offset == 0 && include_writes)
-					return true;
+				accessed = frame->offset == 0 && include_writes;
 				break;
 			case BF_OP_OUT:
-				if (offset == 0 && include_reads)
-					return true;
+				accessed = frame->offset == 0 && include_reads;
 				break;
 			case BF_OP_ALTER:
-				offset -= op->offset;
-				if (offset == 0 && op->amount != 0)
-					return true;
+				frame->offset -= op->offset;
+				accessed = frame->offset == 0 && op->amount != 0;
+				break;
+			case BF_OP_ADD_AT:
+				accessed = frame->offset == op->offset && op->amount != 0;
+				break;
+			case BF_OP_SET_AT:
+			case BF_OP_IN_AT:
+				accessed = frame->offset == op->offset && include_writes;
+				break;
+			case BF_OP_OUT_AT:
+				accessed = frame->offset == op->offset && include_reads;
 				break;
 			case BF_OP_LOOP: {
 				loop_info info = get_loop_info(op);
 				if (info.uncertain_forwards || info.uncertain_backwards)
-					return true;  // Offset is unknown if this happens
-				if (offset == 0 && include_reads)
-					return true;
-				if (offset_might_be_accessed(offset, &op->children, 0, op->children.len, include_reads, include_writes))
-					return true;
+					accessed = true;  // Offset is unknown if this happens
+				else if (frame->offset == 0 && include_reads)
+					accessed = true;
+				else if (op->children.len) {
+					ssize_t inner_offset = frame->offset;
+					if (depth == alloc)
+						stack = grow_stack(stack, fixed, &alloc, sizeof *stack);
+					stack[depth++] = (access_frame) {.arr = &op->children, .pos = 0, .end = op->children.len, .offset = inner_offset};
+				}
 				break;
 			}
 			case BF_OP_SET:
-				if (offset >= 0 && offset <= op->offset && include_writes)
-					return true;
+				accessed = frame->offset >= 0 && frame->offset <= op->offset && include_writes;
 				break;
 			case BF_OP_MULTIPLY:
-				if (offset == 0 && include_reads)
-					return true;
-				if (offset == op->offset && include_writes)
-					return true;
+				accessed = (frame->offset == 0 && include_reads) || (frame->offset == op->offset && include_writes);
+				break;
+			case BF_OP_PRODUCT:
+				accessed = ((frame->offset == 0 || frame->offset == op->factor) && include_reads)
+					|| (frame->offset == op->offset && include_writes);
+				break;
+			case BF_OP_DIVIDE:
+				accessed = frame->offset == 0;
+				break;
+			case BF_OP_WRITE_CONST:
 				break;
 			case BF_OP_SKIP:
-				return true;  // Again, offset is unknown if this happens
+			case BF_OP_CLEAR_RUN:
+			case BF_OP_SHIFT_RUN:
+				accessed = true;  // Again, offset is unknown if this happens
+				break;
 			default:
 				assert(!"Unexpected opcode");
-				return true;
+				accessed = true;
+				break;
 		}
 	}
 
-	return false;
+	if (stack != fixed)
+		free(stack);
+	return accessed;
+}
+
+/*
+ * The inverse of an odd number modulo the range of a cell, by Newton's
+ * method: each step doubles the number of low bits which are right.
+ */
+cell_int cell_inverse(cell_int odd) {
+	assert(odd & 1);
+	uint64_t value = (uint64_t)odd, inverse = value;  // Right in the lowest 3 bits
+	for (int bits = 3; bits < 64; bits *= 2)
+		inverse *= 2 - value * inverse;
+	return (cell_int)inverse;
 }
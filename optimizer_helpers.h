@@ -13,5 +13,6 @@ ssize_t get_max_offset(bf_op *op);
 ssize_t get_min_offset(bf_op *op);
 loop_info get_loop_info(bf_op *op);
 bool offset_might_be_accessed(ssize_t offset, bf_op_builder *arr, size_t start, size_t end, bool include_reads, bool include_writes);
+cell_int cell_inverse(cell_int odd);
 
 #endif
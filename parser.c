@@ -1,8 +1,24 @@
+#define _DEFAULT_SOURCE  // For MAP_POPULATE
+
 #include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
 #include <err.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
 
 #include "parser.h"
 #include "optimizer.h"
+#include "evaluator.h"
+
+#define LEXER_VECTOR_BYTES 16
+// How deep loops can nest before the parser's stack moves to the heap
+#define BUILDER_STACK_FIXED 64
 
 static char op_type_for_char[256] = {
 	['+'] = BF_OP_ALTER,
@@ -15,7 +31,132 @@ static char op_type_for_char[256] = {
 	[']'] = BF_OP_LOOP,
 };
 
-static void alloc_op_by_char(unsigned char op_char, bf_op_builder *builder) {
+/*
+ * Where the parser is up to.  A regular file is mapped into memory and lexed
+ * in bulk; anything else (like stdin, where the program's input comes after
+ * the bang) is read a character at a time.
+ */
+typedef struct {
+	FILE *input;
+	char const *data;  // The mapped file, if it is one
+	size_t pos, len;
+	bool stop_at_bang;
+	bool loop_idioms;  // Whether to recognise loops like [-] as each one is closed
+	uint32_t line, column;  // Of the next character
+	source_range last;  // The character read most recently
+} source_cursor;
+
+#ifdef __SSE2__
+// Marks the bytes of the vector which are brainfuck commands
+static uint32_t command_mask(__m128i bytes) {
+	static char const commands[] = "+-<>,.[]";
+	__m128i hits = _mm_setzero_si128();
+	for (size_t i = 0; i < sizeof commands - 1; i++)
+		hits = _mm_or_si128(hits, _mm_cmpeq_epi8(bytes, _mm_set1_epi8(commands[i])));
+	return (uint32_t)_mm_movemask_epi8(hits);
+}
+
+static uint32_t byte_mask(__m128i bytes, char c) {
+	return (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(bytes, _mm_set1_epi8(c)));
+}
+#endif
+
+/*
+ * Skips everything up to the next command in a mapped file, keeping count of
+ * the lines passed over.  Most of a commented program is comments, so this is
+ * done a vector at a time.
+ */
+static void skip_comment(source_cursor *restrict cursor) {
+	char const *data = cursor->data;
+	size_t start = cursor->pos, pos = start, len = cursor->len;
+	size_t line_start = 0;  // Just past the last newline passed over
+	uint32_t newlines = 0;
+
+#ifdef __SSE2__
+	for (; pos + LEXER_VECTOR_BYTES <= len; pos += LEXER_VECTOR_BYTES) {
+		__m128i bytes = _mm_loadu_si128((__m128i const*)(data + pos));
+		uint32_t commands = command_mask(bytes);
+		uint32_t lines = byte_mask(bytes, '\n');
+		if (commands)
+			lines &= (commands & -commands) - 1;  // Only the ones before the command
+		if (lines) {
+			newlines += __builtin_popcount(lines);
+			line_start = pos + (31 - __builtin_clz(lines)) + 1;
+		}
+		if (commands) {
+			pos += __builtin_ctz(commands);
+			goto done;
+		}
+	}
+#endif
+
+	for (; pos < len && op_type_for_char[(unsigned char)data[pos]] == BF_OP_INVALID; pos++) {
+		if (data[pos] == '\n') {
+			newlines++;
+			line_start = pos + 1;
+		}
+	}
+
+#ifdef __SSE2__
+done:
+#endif
+	if (newlines) {
+		cursor->line += newlines;
+		cursor->column = pos - line_start + 1;
+	} else {
+		cursor->column += pos - start;
+	}
+	cursor->pos = pos;
+}
+
+/*
+ * Takes the rest of a run of two opposite commands (like + and -) in a mapped
+ * file, adding its source to the op's.  Returns how many more of the first
+ * there were than of the second.
+ */
+static ssize_t take_run(source_cursor *restrict cursor, char up, char down, source_range *restrict source) {
+	char const *data = cursor->data;
+	size_t start = cursor->pos, pos = start, len = cursor->len;
+	ssize_t net = 0;
+
+#ifdef __SSE2__
+	for (; pos + LEXER_VECTOR_BYTES <= len; pos += LEXER_VECTOR_BYTES) {
+		__m128i bytes = _mm_loadu_si128((__m128i const*)(data + pos));
+		uint32_t ups = byte_mask(bytes, up), downs = byte_mask(bytes, down);
+		uint32_t run = ups | downs;
+		if (run != (1u << LEXER_VECTOR_BYTES) - 1) {
+			int run_len = __builtin_ctz(~run);
+			uint32_t in_run = (1u << run_len) - 1;
+			net += __builtin_popcount(ups & in_run) - __builtin_popcount(downs & in_run);
+			pos += run_len;
+			goto done;
+		}
+		net += __builtin_popcount(ups) - __builtin_popcount(downs);
+	}
+#endif
+
+	for (; pos < len && (data[pos] == up || data[pos] == down); pos++)
+		net += data[pos] == up ? 1 : -1;
+
+#ifdef __SSE2__
+done:
+#endif
+	if (pos != start) {
+		// Runs never cross a line
+		cursor->last = (source_range) {
+			.first_line = cursor->line,
+			.first_column = cursor->column,
+			.last_line = cursor->line,
+			.last_column = cursor->column + (pos - start) - 1,
+		};
+		*source = source_range_union(*source, cursor->last);
+		cursor->column += pos - start;
+		cursor->pos = pos;
+	}
+	return net;
+}
+
+static void alloc_op_by_char(unsigned char op_char, bf_op_builder *builder, source_range at) {
 	bool need_alloc = true;
 	if (builder->len != 0) {
 		bf_op *last = &builder->ops[builder->len - 1];
@@ -31,32 +172,95 @@ static void alloc_op_by_char(unsigned char op_char, bf_op_builder *builder) {
 					need_alloc = false;
 				break;
 		}
+		if (!need_alloc)
+			last->source = source_range_union(last->source, at);
 	}
-	if (op_char == ']')
-		need_alloc = false;
 	if (need_alloc)
 		*alloc_bf_op(builder) = (bf_op){
 			.op_type = op_type_for_char[op_char],
+			.source = at,
 		};
 }
 
-bf_op_builder build_bf_tree_internal(FILE *restrict input, bool stop_at_bang, bool expecting_bracket) {
-	bf_op_builder builder;
-	builder.alloc = 16;
-	builder.len = 0;
-	builder.ops = malloc(builder.alloc * sizeof *builder.ops);
+static int next_char(source_cursor *restrict cursor) {
+	int c;
+	if (cursor->data) {
+		if (cursor->pos == cursor->len)
+			return EOF;
+		c = (unsigned char)cursor->data[cursor->pos++];
+	} else {
+		c = getc(cursor->input);
+		if (c == EOF)
+			return c;
+	}
+
+	cursor->last = (source_range) {
+		.first_line = cursor->line,
+		.first_column = cursor->column,
+		.last_line = cursor->line,
+		.last_column = cursor->column,
+	};
+	if (c == '\n') {
+		cursor->line++;
+		cursor->column = 1;
+	} else {
+		cursor->column++;
+	}
+	return c;
+}
+
+// An empty builder is left without an array
+static bf_op_builder finish_builder(bf_op_builder builder) {
+	if (builder.len == 0) {
+		bf_arena_release(builder.arena, builder.ops, builder.alloc * sizeof *builder.ops);
+		builder = (bf_op_builder) {.arena = builder.arena};
+	}
+	return builder;
+}
+
+/*
+ * Finishes the loop at the top of the stack, which becomes the children of
+ * the last op of the builder under it.  Its ops are usually the latest thing
+ * in the arena, so if the loop is optimized away, they go straight back.
+ */
+static void close_loop(bf_op_builder *restrict stack, size_t *restrict depth, source_cursor *restrict cursor) {
+	bf_op_builder children = finish_builder(stack[--*depth]);
+
+	bf_op_builder *parent = &stack[*depth - 1];
+	bf_op *op = &parent->ops[parent->len - 1];
+	op->children = children;
+	// The loop runs up to its closing bracket
+	op->source = source_range_union(op->source, cursor->last);
+	optimize_loop(parent, cursor->loop_idioms);
+
+	bf_op *last = &parent->ops[parent->len - 1];
+	if (last->op_type != BF_OP_LOOP || last->children.ops != children.ops)
+		bf_arena_release(children.arena, children.ops, children.alloc * sizeof *children.ops);
+}
+
+/*
+ * Loops are parsed with an explicit stack of the builders for each one still
+ * open, rather than by recursion, so that nesting is only limited by memory.
+ */
+static bf_op_builder build_bf_ops(source_cursor *restrict cursor, bf_arena *arena) {
+	bf_op_builder fixed[BUILDER_STACK_FIXED];
+	bf_op_builder *stack = fixed;
+	size_t depth = 1, alloc = BUILDER_STACK_FIXED;
+	stack[0] = (bf_op_builder) {.arena = arena};
 
 	while (true) {
-		int c = getc(input);
+		if (cursor->data)
+			skip_comment(cursor);
+		int c = next_char(cursor);
 		if (c == EOF) {
-			if (feof(input))
+			if (cursor->data || feof(cursor->input))
 				break;
 			else
 				err(2, "could not read brainfuck code");
 		}
 
-		if (stop_at_bang && c == '!') {
-			if (expecting_bracket)
+		if (cursor->stop_at_bang && c == '!') {
+			if (depth > 1)
 				warnx("warning: found a bang inside a loop; ignoring.");
 			else
 				break;
@@ -65,49 +269,176 @@ bf_op_builder build_bf_tree_internal(FILE *restrict input, bool stop_at_bang, bo
 		if (op_type_for_char[c] == BF_OP_INVALID)
 			continue;
 
-		alloc_op_by_char(c, &builder);
+		bf_op_builder *builder = &stack[depth - 1];
+		if (c == ']') {
+			if (depth == 1) errx(1, "Unexpected end of loop");
+			close_loop(stack, &depth, cursor);
+			continue;
+		}
+
+		alloc_op_by_char(c, builder, cursor->last);
 
-		bf_op *op = &builder.ops[builder.len - 1];
+		bf_op *op = &builder->ops[builder->len - 1];
 		switch (c) {
 			case '+':
-				op->amount++;
-				break;
 			case '-':
-				op->amount--;
+				op->amount += c == '+' ? 1 : -1;
+				if (cursor->data)
+					op->amount += take_run(cursor, '+', '-', &op->source);
 				break;
 			case '>':
-				op->offset++;
-				break;
 			case '<':
-				op->offset--;
+				op->offset += c == '>' ? 1 : -1;
+				if (cursor->data)
+					op->offset += take_run(cursor, '>', '<', &op->source);
 				break;
 			case '[':
-				op->children = build_bf_tree_internal(input, stop_at_bang, true);
-				optimize_loop(&builder);
+				if (depth == alloc)
+					stack = grow_stack(stack, fixed, &alloc, sizeof *stack);
+				stack[depth++] = (bf_op_builder) {.arena = arena};
 				break;
-			case ']':
-				if (!expecting_bracket) errx(1, "Unexpected end of loop");
-				goto end;
 		}
 	}
 
-end:
-	if (builder.len == 0) {
-		free(builder.ops);
-		builder.alloc = 0;
-		builder.ops = NULL;
+	// Any loops left open at the end are closed there
+	while (depth > 1)
+		close_loop(stack, &depth, cursor);
+
+	bf_op_builder root = finish_builder(stack[0]);
+	if (stack != fixed)
+		free(stack);
+	return root;
+}
+
+static double seconds_since(struct timespec start) {
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (now.tv_sec - start.tv_sec) + (now.tv_nsec - start.tv_nsec) / 1e9;
+}
+
+// One line of --time-passes, for a pass which left the tree with ops ops, where there had been before
+static void report_pass(pass_pipeline const *pipeline, char const *name, unsigned round, struct timespec start, size_t before, size_t ops) {
+	if (!pipeline->time_passes)
+		return;
+	double ms = seconds_since(start) * 1000;
+	char label[32];
+	if (round > 1)
+		snprintf(label, sizeof label, "%s #%u", name, round);
+	else
+		snprintf(label, sizeof label, "%s", name);
+	fprintf(stderr, "%-18s %12.3f %12zu %+12zd\n", label, ms, ops, (ssize_t)(ops - before));
+}
+
+// Returns false if the pass isn't run here, as it was done while parsing or doesn't suit the tape
+static bool run_pass(bf_op_builder *ops, enum bf_pass pass, size_t eval_steps, bool *changed) {
+	switch (pass) {
+		case PASS_EVALUATE:
+			*changed = evaluate_prefix(ops, eval_steps);
+			return true;
+
+		// These take cells at different offsets for different cells, which
+		// they needn't be once the offsets wrap around a fixed tape
+#ifndef FIXED_TAPE_SIZE
+		case PASS_KNOWN_OUTPUT:
+			*changed = write_known_output(ops);
+			return true;
+
+		case PASS_DEAD_STORES:
+			*changed = remove_dead_stores(ops);
+			return true;
+
+		case PASS_DEFER_MOVES:
+			*changed = defer_moves(ops);
+			return true;
+#endif
+
+		default:
+			// The loop idioms were done while parsing
+			return false;
+	}
+}
+
+/*
+ * Runs the pipeline's passes over the parsed tree in order, then the ones
+ * which repeat over again, until a round of them leaves the tree as it was
+ * (which is when they've run out of things to do) or the rounds run out.
+ */
+static void run_passes(bf_op_builder *ops, pass_pipeline const *pipeline, size_t eval_steps) {
+	size_t count = pipeline->time_passes ? count_bf_ops(ops) : 0;
+	for (unsigned round = 1; round <= pipeline->rounds; round++) {
+		bool changed = false;
+		for (size_t i = 0; i < pipeline->len; i++) {
+			enum bf_pass pass = pipeline->passes[i];
+			if (round > 1 && !pass_repeats(pass))
+				continue;
+
+			struct timespec start;
+			clock_gettime(CLOCK_MONOTONIC, &start);
+			bool pass_changed;
+			if (!run_pass(ops, pass, eval_steps, &pass_changed))
+				continue;
+			changed |= pass_changed;
+
+			size_t before = count;
+			if (pipeline->time_passes)
+				count = count_bf_ops(ops);
+			report_pass(pipeline, pass_name(pass), round, start, before, count);
+		}
+		if (!changed)
+			break;
 	}
-	return builder;
 }
 
-bf_op build_bf_tree(FILE *input, bool stop_at_bang) {
+bf_op build_bf_tree(FILE *input, bool stop_at_bang, bool bounds_checks, size_t eval_steps, pass_pipeline const *pipeline, bf_arena *arena) {
 	bf_op root = {.op_type = BF_OP_ONCE};
-	root.children = build_bf_tree_internal(input, stop_at_bang, false);
+	source_cursor cursor = {
+		.input = input,
+		.stop_at_bang = stop_at_bang,
+		.loop_idioms = pipeline_has_pass(pipeline, PASS_LOOP_IDIOMS),
+		.line = 1,
+		.column = 1,
+	};
+
+	if (pipeline->time_passes)
+		fprintf(stderr, "%-18s %12s %12s %12s\n", "Pass", "Time (ms)", "Ops", "Change");
+	struct timespec start;
+	clock_gettime(CLOCK_MONOTONIC, &start);
+
+	// The bang has to be found a character at a time, so as not to read past it
+	struct stat st;
+	void *mapping = MAP_FAILED;
+	off_t offset = ftello(input);
+	if (!stop_at_bang && offset >= 0 && !fstat(fileno(input), &st) && S_ISREG(st.st_mode) && st.st_size > offset) {
+		mapping = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE | MAP_POPULATE, fileno(input), 0);
+		if (mapping != MAP_FAILED) {
+			cursor.data = mapping;
+			cursor.pos = offset;
+			cursor.len = st.st_size;
+		}
+	}
+
+	root.children = build_bf_ops(&cursor, arena);
+
+	if (mapping != MAP_FAILED)
+		munmap(mapping, st.st_size);
 
 	optimize_root(&root.children);
+	if (pipeline->time_passes)
+		report_pass(pipeline, "parse", 1, start, 0, count_bf_ops(&root.children));
 
+	run_passes(&root.children, pipeline, eval_steps);
+
+	// Whatever else ran, a tape which grows has to be checked before it's used
 #ifndef FIXED_TAPE_SIZE
-	add_bounds_checks(&root.children);
+	if (bounds_checks) {
+		size_t before = pipeline->time_passes ? count_bf_ops(&root.children) : 0;
+		clock_gettime(CLOCK_MONOTONIC, &start);
+		add_bounds_checks(&root.children);
+		if (pipeline->time_passes)
+			report_pass(pipeline, "bounds-checks", 1, start, before, count_bf_ops(&root.children));
+	}
+#else
+	(void)bounds_checks;
 #endif
 
 	return root;
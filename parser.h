@@ -4,7 +4,13 @@
 #include <stdio.h>
 
 #include "brainfuck.h"
+#include "passes.h"
 
-bf_op build_bf_tree(FILE *input, bool stop_at_bang);
+/*
+ * The tree is allocated from the arena, and lasts until it's freed.  The
+ * pipeline's passes are run over it once it's parsed, with up to eval_steps of
+ * the program run while building it if it asks for that (see evaluator.h).
+ */
+bf_op build_bf_tree(FILE *input, bool stop_at_bang, bool bounds_checks, size_t eval_steps, pass_pipeline const *pipeline, bf_arena *arena);
 
 #endif
@@ -0,0 +1,101 @@
+#include <string.h>
+
+#include "passes.h"
+
+static struct {
+	char const *name;
+	bool repeats;
+} const pass_info[PASS_COUNT] = {
+#define PASS_INFO(id, name, repeats) [id] = {name, repeats},
+	FOR_EACH_PASS(PASS_INFO)
+#undef PASS_INFO
+};
+
+// How many times -O3 runs the passes which repeat, at most
+#define FIXPOINT_ROUNDS 8
+
+char const *pass_name(enum bf_pass pass) {
+	return pass_info[pass].name;
+}
+
+bool pass_repeats(enum bf_pass pass) {
+	return pass_info[pass].repeats;
+}
+
+bool pipeline_has_pass(pass_pipeline const *pipeline, enum bf_pass pass) {
+	for (size_t i = 0; i < pipeline->len; i++) {
+		if (pipeline->passes[i] == pass)
+			return true;
+	}
+	return false;
+}
+
+/*
+ * -O0 only does what's needed to run the program, and -O1 adds the loop idioms,
+ * which cost next to nothing while parsing.  -O2 runs every pass once, and -O3
+ * goes on until the tree stops changing.
+ */
+void pipeline_preset(pass_pipeline *pipeline, int level) {
+	pipeline->len = 0;
+	pipeline->rounds = level >= 3 ? FIXPOINT_ROUNDS : 1;
+	if (level >= 1)
+		pipeline->passes[pipeline->len++] = PASS_LOOP_IDIOMS;
+	if (level >= 2) {
+		for (enum bf_pass pass = PASS_EVALUATE; pass < PASS_COUNT; pass++)
+			pipeline->passes[pipeline->len++] = pass;
+	}
+}
+
+// Returns PASS_COUNT if the first length characters of name aren't a pass's name
+static enum bf_pass find_pass(char const *name, size_t length) {
+	for (enum bf_pass pass = 0; pass < PASS_COUNT; pass++) {
+		if (strlen(pass_info[pass].name) == length && !strncmp(pass_info[pass].name, name, length))
+			return pass;
+	}
+	return PASS_COUNT;
+}
+
+/*
+ * Replaces the passes with the comma-separated list of them in names, which
+ * can be empty for none.  Returns false, leaving the pipeline as it was, if
+ * any of them doesn't exist or there are too many.
+ */
+bool pipeline_parse(pass_pipeline *pipeline, char const *names) {
+	pass_pipeline parsed = *pipeline;
+	parsed.len = 0;
+	while (*names) {
+		size_t length = strcspn(names, ",");
+		enum bf_pass pass = find_pass(names, length);
+		if (pass == PASS_COUNT || parsed.len == MAX_PIPELINE_PASSES)
+			return false;
+		parsed.passes[parsed.len++] = pass;
+
+		names += length;
+		if (*names)
+			names++;
+	}
+	*pipeline = parsed;
+	return true;
+}
+
+// Takes each of the comma-separated passes in names out, returning false if one doesn't exist
+bool pipeline_disable(pass_pipeline *pipeline, char const *names) {
+	while (*names) {
+		size_t length = strcspn(names, ",");
+		enum bf_pass pass = find_pass(names, length);
+		if (pass == PASS_COUNT)
+			return false;
+
+		size_t to = 0;
+		for (size_t from = 0; from < pipeline->len; from++) {
+			if (pipeline->passes[from] != pass)
+				pipeline->passes[to++] = pipeline->passes[from];
+		}
+		pipeline->len = to;
+
+		names += length;
+		if (*names)
+			names++;
+	}
+	return true;
+}
@@ -0,0 +1,53 @@
+#ifndef USING_PASSES_H
+#define USING_PASSES_H
+
+/*
+ * The optimization passes which can be picked on the command line.  Loop
+ * idioms are recognised while parsing, as each loop is closed; the rest run
+ * over the whole tree afterwards, in the order they're listed.  The parser's
+ * own peephole pass and the bounds checks aren't listed, as the program can't
+ * be run without them.  (Shared between variants, which run the passes
+ * themselves in parser.c.)
+ */
+#include <stdbool.h>
+#include <stddef.h>
+
+/*
+ * X(id, name, repeats), where the passes which repeat are run over the tree
+ * again with -O3, for as long as they keep changing it.
+ */
+#define FOR_EACH_PASS(X) \
+	X(PASS_LOOP_IDIOMS, "loop-idioms", false) \
+	X(PASS_EVALUATE, "evaluate", false) \
+	X(PASS_KNOWN_OUTPUT, "known-output", true) \
+	X(PASS_DEAD_STORES, "dead-stores", true) \
+	X(PASS_DEFER_MOVES, "defer-moves", true)
+
+enum bf_pass {
+#define PASS_ENUM(id, name, repeats) id,
+	FOR_EACH_PASS(PASS_ENUM)
+#undef PASS_ENUM
+	PASS_COUNT
+};
+
+#define DEFAULT_OPT_LEVEL 2
+#define MAX_OPT_LEVEL 3
+
+// Enough for every pass a few times over
+#define MAX_PIPELINE_PASSES 32
+
+typedef struct {
+	unsigned char passes[MAX_PIPELINE_PASSES];  // In the order they're run
+	size_t len;
+	unsigned rounds;  // How many times the passes which repeat can be run, at most
+	bool time_passes;  // Whether to print how long each pass took to stderr
+} pass_pipeline;
+
+char const *pass_name(enum bf_pass pass);
+bool pass_repeats(enum bf_pass pass);
+bool pipeline_has_pass(pass_pipeline const *pipeline, enum bf_pass pass);
+void pipeline_preset(pass_pipeline *pipeline, int level);
+bool pipeline_parse(pass_pipeline *pipeline, char const *names);
+bool pipeline_disable(pass_pipeline *pipeline, char const *names);
+
+#endif
@@ -0,0 +1,207 @@
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "profile.h"
+#include "debug.h"
+
+typedef struct {
+	size_t start, end;  // From its first jump (or its body, if it has none) to just past its last
+	uint64_t cost;  // Ops run inside it, including inside loops nested in it
+	uint64_t entered;  // Times execution reached it, including when it was skipped over
+	uint64_t trips;  // Times its body ran
+} loop_profile;
+
+typedef struct {
+	enum bf_op_type type;
+	uint64_t count;
+} op_type_profile;
+
+void profile_init(op_profile *profile, char *bytecode) {
+	size_t length = bytecode_length(bytecode);
+	*profile = (op_profile) {
+		.bytecode = bytecode,
+		.executed = calloc(length, sizeof *profile->executed),
+		.taken = calloc(length, sizeof *profile->taken),
+	};
+}
+
+void profile_free(op_profile *profile) {
+	free(profile->executed);
+	free(profile->taken);
+}
+
+/*
+ * Finds the loops in the bytecode and how they were run.  A loop which is
+ * known to start on a nonzero cell has no JUMPIFZERO, and one which can't
+ * repeat has no JUMPIFNONZERO, so the two jumps of a loop are matched up by
+ * where they lead to or from: just past the end of it.
+ */
+static loop_profile *find_loops(op_profile *restrict profile, size_t length, size_t *restrict count) {
+	size_t *loop_ending_at = calloc(length + 1, sizeof *loop_ending_at);  // Index into loops plus 1, or 0
+	loop_profile *loops = NULL;
+	size_t loop_count = 0, loop_alloc = 0;
+
+	for (size_t address = 0; address < length;) {
+		char *op = &profile->bytecode[address];
+		size_t size = bytecode_op_size(op);
+		enum bf_op_type type = BYTECODE_OP(*op);
+		uint64_t executed = profile->executed[address], taken = profile->taken[address];
+
+		if (type == BF_OP_JUMPIFZERO || type == BF_OP_JUMPIFNONZERO || type == BF_OP_MOVE_JUMPIFNONZERO) {
+			ssize_t distance = *(jump_offset*)&op[size - sizeof(jump_offset)];
+			size_t end = type == BF_OP_JUMPIFZERO ? address + size + distance : address + size;
+
+			if (type != BF_OP_JUMPIFZERO && loop_ending_at[end]) {
+				// The end of a loop with a JUMPIFZERO at the start
+				loops[loop_ending_at[end] - 1].trips = executed;
+			} else {
+				if (loop_count == loop_alloc) {
+					loop_alloc = loop_alloc ? loop_alloc * 2 : 16;
+					loops = realloc(loops, loop_alloc * sizeof *loops);
+				}
+				if (type == BF_OP_JUMPIFZERO) {
+					// Until the loop's JUMPIFNONZERO turns up (if it does), it's an if
+					loops[loop_count] = (loop_profile) {
+						.start = address,
+						.end = end,
+						.entered = executed,
+						.trips = executed - taken,
+					};
+				} else {
+					// Every time the loop is entered, it leaves once
+					loops[loop_count] = (loop_profile) {
+						.start = end + distance,
+						.end = end,
+						.entered = executed - taken,
+						.trips = executed,
+					};
+				}
+				loop_ending_at[end] = ++loop_count;
+			}
+		}
+		address += size;
+	}
+
+	// Ops run before each address, so the cost of a loop is the difference between its ends
+	uint64_t *run_before = malloc((length + 1) * sizeof *run_before);
+	run_before[0] = 0;
+	for (size_t address = 0; address < length; address++)
+		run_before[address + 1] = run_before[address] + profile->executed[address];
+	for (size_t i = 0; i < loop_count; i++)
+		loops[i].cost = run_before[loops[i].end] - run_before[loops[i].start];
+
+	free(run_before);
+	free(loop_ending_at);
+	*count = loop_count;
+	return loops;
+}
+
+static int compare_loops(void const *a, void const *b) {
+	uint64_t cost_a = ((loop_profile const*)a)->cost, cost_b = ((loop_profile const*)b)->cost;
+	return (cost_a < cost_b) - (cost_a > cost_b);
+}
+
+static int compare_op_types(void const *a, void const *b) {
+	uint64_t count_a = ((op_type_profile const*)a)->count, count_b = ((op_type_profile const*)b)->count;
+	return (count_a < count_b) - (count_a > count_b);
+}
+
+static double percent(uint64_t part, uint64_t total) {
+	return total ? 100.0 * part / total : 0;
+}
+
+/*
+ * Prints to stderr what ran how often, with the most expensive ops and loops
+ * first.
+ */
+void print_profile(op_profile *profile, source_map const *map) {
+	size_t length = bytecode_length(profile->bytecode);
+
+	op_type_profile types[BF_OP_COUNT];
+	for (int type = 0; type < BF_OP_COUNT; type++)
+		types[type] = (op_type_profile) {.type = type};
+	uint64_t total = 0;
+	for (size_t address = 0; address < length; address += bytecode_op_size(&profile->bytecode[address])) {
+		types[BYTECODE_OP(profile->bytecode[address])].count += profile->executed[address];
+		total += profile->executed[address];
+	}
+	qsort(types, BF_OP_COUNT, sizeof *types, compare_op_types);
+
+	fprintf(stderr, "\nRan %" PRIu64 " ops; the tape was reallocated %zu times\n", total, profile->reallocations);
+
+	fprintf(stderr, "\nOps by times run:\n"
+	                "%14s %6s  %s\n", "count", "%", "op");
+	for (int i = 0; i < BF_OP_COUNT && types[i].count; i++)
+		fprintf(stderr, "%14" PRIu64 " %5.1f%%  %s\n", types[i].count, percent(types[i].count, total), flattened_op_name(types[i].type));
+
+	size_t loop_count;
+	loop_profile *loops = find_loops(profile, length, &loop_count);
+	if (loop_count)
+		qsort(loops, loop_count, sizeof *loops, compare_loops);
+
+	fprintf(stderr, "\nLoops by ops run inside them (addresses as shown by --dump-opcodes):\n"
+	                "%8s %8s %14s %6s %12s %14s %12s  %s\n", "start", "end", "ops", "%", "entered", "trips", "avg trips", "source");
+	for (size_t i = 0; i < loop_count && loops[i].entered; i++) {
+		loop_profile *loop = &loops[i];
+		fprintf(stderr, "%08zx %08zx %14" PRIu64 " %5.1f%% %12" PRIu64 " %14" PRIu64 " %12.1f  ",
+			loop->start, loop->end, loop->cost, percent(loop->cost, total),
+			loop->entered, loop->trips, (double)loop->trips / loop->entered);
+
+		// From the start of its first op to the end of its last
+		source_range first = source_map_find(map, loop->start), last = source_map_find(map, loop->end - 1);
+		first.last_line = last.last_line;
+		first.last_column = last.last_column;
+		print_source_range(stderr, first);
+		fputc('\n', stderr);
+	}
+
+	free(loops);
+}
+
+/*
+ * Prints to stderr the whole of the source, with how many ops were run for
+ * each line.  An op counts towards the line its source starts on, so an op
+ * made from several lines (like a loop turned into a multiply) is only
+ * counted once.
+ */
+void print_annotated_source(op_profile *profile, source_map const *map, FILE *source) {
+	size_t length = bytecode_length(profile->bytecode);
+
+	uint32_t lines = 0;
+	for (size_t i = 0; i < map->len; i++) {
+		if (map->entries[i].source.last_line > lines)
+			lines = map->entries[i].source.last_line;
+	}
+	uint64_t *line_counts = calloc(lines + 1, sizeof *line_counts);
+	uint64_t total = 0;
+	for (size_t address = 0; address < length; address += bytecode_op_size(&profile->bytecode[address])) {
+		line_counts[source_map_find(map, address).first_line] += profile->executed[address];
+		total += profile->executed[address];
+	}
+
+	fprintf(stderr, "\nOps run for each line of the source:\n"
+	                "%14s %6s %6s  %s\n", "count", "%", "line", "source");
+	uint32_t line = 1;
+	bool at_line_start = true;
+	for (int c; (c = getc(source)) != EOF;) {
+		if (at_line_start) {
+			uint64_t count = line <= lines ? line_counts[line] : 0;
+			if (count)
+				fprintf(stderr, "%14" PRIu64 " %5.1f%% %6" PRIu32 "  ", count, percent(count, total), line);
+			else
+				fprintf(stderr, "%14s %6s %6" PRIu32 "  ", "", "", line);
+			at_line_start = false;
+		}
+		fputc(c, stderr);
+		if (c == '\n') {
+			line++;
+			at_line_start = true;
+		}
+	}
+	if (!at_line_start)
+		fputc('\n', stderr);
+
+	free(line_counts);
+}
@@ -0,0 +1,42 @@
+#ifndef USING_PROFILE_H
+#define USING_PROFILE_H
+
+/*
+ * Counters for --profile, which runs the program through the switch
+ * interpreter recording how often each op in the bytecode runs.  With the
+ * source map from the flattener, the counts can be traced back to the source.
+ */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "brainfuck.h"
+#include "flattener.h"
+
+typedef struct op_profile {
+	char *bytecode;
+	uint64_t *executed;  // Indexed by bytecode address: times the op there has run
+	uint64_t *taken;  // Indexed by bytecode address: times the jump there was taken
+	char *previous;  // The op which ran last, if any
+	char *fallthrough;  // Where execution goes if the previous op doesn't jump
+	size_t reallocations;  // Times the tape had to grow
+} op_profile;
+
+void profile_init(op_profile *profile, char *bytecode);
+void profile_free(op_profile *profile);
+void print_profile(op_profile *profile, source_map const *map);
+void print_annotated_source(op_profile *profile, source_map const *map, FILE *source);
+
+/*
+ * Records the op about to run at the given address.  A jump was taken if
+ * the op before it in time isn't the one before it in the bytecode.
+ */
+inline static void profile_op(op_profile *restrict profile, char *restrict op) {
+	if (op != profile->fallthrough && profile->previous)
+		profile->taken[profile->previous - profile->bytecode]++;
+	profile->executed[op - profile->bytecode]++;
+	profile->previous = op;
+	profile->fallthrough = op + bytecode_op_size(op);
+}
+
+#endif
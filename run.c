@@ -0,0 +1,173 @@
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "run.h"
+#include "batch.h"
+#include "bytecode_file.h"
+#include "parser.h"
+#include "flattener.h"
+#include "interpreter.h"
+#include "profile.h"
+#include "tape.h"
+#include "debug.h"
+
+typedef struct {
+	char *bytecode;
+	size_t length;
+	interpreter_meta meta;
+	run_options const *options;
+} compiled_program;
+
+/*
+ * Runs the program with the engine picked by the options.
+ */
+static void execute(compiled_program const *program, bf_io *io) {
+	run_options const *options = program->options;
+	if (options->count_sequences)
+		execute_bf_counting(program->bytecode, program->meta, io);
+	else if (options->jit)
+		execute_bf_jit(program->bytecode, program->meta, io);
+	else if (options->tiered)
+		execute_bf_tiered(program->bytecode, program->meta, io);
+	else if (options->threaded)
+		execute_bf_threaded(program->bytecode, program->meta, io);
+	else
+		execute_bf(program->bytecode, program->meta, io);
+}
+
+// One run of a --batch (which can be on any thread)
+static void execute_batch_input(void *context, int in_fd, int out_fd) {
+	compiled_program own = *(compiled_program const*)context;
+	// Tiering patches the jumps of hot loops, so it needs a copy to itself
+	if (own.options->tiered) {
+		own.bytecode = malloc(own.length);
+		memcpy(own.bytecode, ((compiled_program const*)context)->bytecode, own.length);
+	}
+
+	bf_io io;
+	io_init(&io, in_fd, out_fd, own.options->buffering);
+	execute(&own, &io);
+	io_free(&io);
+
+	if (own.options->tiered)
+		free(own.bytecode);
+}
+
+static interpreter_meta compile(FILE *file, run_options const *options, blob_cursor *flat, source_map *map) {
+	bf_arena arena = {0};
+	bf_op root = build_bf_tree(file, file == stdin, options->tape_kind == TAPE_REALLOC, options->eval_steps, &options->pipeline, &arena);
+
+	if (options->dump_tree)
+		print_bf_op(&root, 0);
+
+	*flat = (blob_cursor) {
+		.data = malloc(128),
+		.pos = 0,
+		.len = 128,
+	};
+	interpreter_meta meta = flatten_bf(&root, flat, map);
+
+	// The whole tree goes at once
+	bf_arena_free(&arena);
+	return meta;
+}
+
+static bool save_bytecode(char const *path, blob_cursor const *flat, interpreter_meta meta, run_options const *options) {
+	bytecode_header header = {
+		.cell_bits = CHAR_BIT * sizeof(cell_int),
+		.tape_kind = options->tape_kind,
+		.lowest_negative_skip = meta.lowest_negative_skip,
+		.highest_positive_skip = meta.highest_positive_skip,
+		.length = flat->pos,
+		.source = options->source,
+	};
+	return bytecode_file_write(path, header, flat->data);
+}
+
+int run_program(FILE *file, run_options const *options) {
+	int status = 0;
+	blob_cursor flat;
+	source_map map = {0};
+	interpreter_meta meta;
+	if (options->loaded) {
+		// Already compiled: the bytecode file was run, or found in the cache
+		bytecode_header const *header = options->loaded->header;
+		flat = (blob_cursor) {
+			.data = options->loaded->bytecode,
+			.pos = header->length,
+			.len = header->length,
+		};
+		meta = (interpreter_meta) {
+			.lowest_negative_skip = header->lowest_negative_skip,
+			.highest_positive_skip = header->highest_positive_skip,
+		};
+	} else {
+		meta = compile(file, options, &flat, &map);
+		if (options->cache_path)
+			save_bytecode(options->cache_path, &flat, meta, options);
+	}
+	meta.tape_kind = options->tape_kind;
+
+	if (options->emit_bytecode && !save_bytecode(options->emit_bytecode, &flat, meta, options))
+		status = 1;
+
+	// The annotated source needs the source again once the program has run
+	if (file != stdin && !options->annotate)
+		fclose(file);
+
+	if (options->dump_opcodes)
+		print_flattened(flat.data, &map);
+
+	compiled_program program = {
+		.bytecode = flat.data,
+		.length = flat.pos,
+		.meta = meta,
+		.options = options,
+	};
+	if (options->execute && options->batch) {
+		// Otherwise every run shares the bytecode, which nothing writes to
+		fflush(stdout);
+		batch inputs = *options->batch;
+		if (meta.tape_kind == TAPE_VM || meta.tape_kind == TAPE_VM_HUGE) {
+			if (inputs.jobs > TAPE_VM_MAX_TAPES)
+				inputs.jobs = TAPE_VM_MAX_TAPES;
+		}
+		if (!run_batch(&inputs, execute_batch_input, &program))
+			status = 1;
+	} else if (options->execute) {
+		// Anything printed so far must come before the program's output
+		fflush(stdout);
+
+		bf_io io;
+		io_init(&io, STDIN_FILENO, STDOUT_FILENO, options->buffering);
+
+		op_profile profile = {0};
+		if (options->profile) {
+			profile_init(&profile, flat.data);
+			execute_bf_profiling(flat.data, meta, &io, &profile);
+		} else {
+			execute(&program, &io);
+		}
+
+		io_free(&io);
+
+		if (options->profile) {
+			print_profile(&profile, &map);
+			if (options->annotate) {
+				rewind(file);
+				print_annotated_source(&profile, &map, file);
+			}
+			profile_free(&profile);
+		}
+	}
+
+	if (file != stdin && options->annotate)
+		fclose(file);
+	free(map.entries);
+	if (!options->loaded)
+		free(flat.data);
+	return status;
+}
@@ -0,0 +1,52 @@
+#ifndef USING_RUN_H
+#define USING_RUN_H
+
+/*
+ * Parsing, optimizing and running a program, which is all specific to one
+ * width of cell and kind of tape.  There is a run_program for each variant
+ * (see variant.h), and main picks which one to call.
+ */
+#include <stdbool.h>
+#include <stdio.h>
+
+#include "interpreter.h"
+#include "batch.h"
+#include "bytecode_file.h"
+#include "passes.h"
+
+// Enough for most programs to set themselves up, without taking long to compile
+#define DEFAULT_EVAL_STEPS 1000000
+
+typedef struct {
+	bool dump_tree, dump_opcodes, execute;
+	bool threaded, jit, tiered, count_sequences, profile, annotate;
+	enum output_buffering buffering;
+	enum tape_kind tape_kind;
+	size_t eval_steps;  // How much of the program to run while compiling it
+	pass_pipeline pipeline;  // The optimization passes to run while compiling it
+	batch const *batch;  // The inputs to run the program against, for --batch
+	bytecode_file const *loaded;  // The program, if it's already compiled
+	char const *emit_bytecode;  // Where to save the compiled program, if anywhere
+	char const *cache_path;  // Where to save it in the cache, if it wasn't there
+	bytecode_source source;  // What it was compiled from, to save with it
+} run_options;
+
+// Returns the exit status
+typedef int run_function(FILE *file, run_options const *options);
+
+/*
+ * The variants built into the executable, which have to match VARIANTS in the
+ * Makefile: X(cell bits, tape, tape kind), where the tape kind of a variant
+ * with a growing tape is TAPE_REALLOC (it handles the TAPE_VM kinds too).
+ */
+#define FOR_EACH_VARIANT(X) \
+	X(8, growing, TAPE_REALLOC) X(8, fixed8, TAPE_FIXED_256) X(8, fixed16, TAPE_FIXED_65536) \
+	X(16, growing, TAPE_REALLOC) X(16, fixed8, TAPE_FIXED_256) X(16, fixed16, TAPE_FIXED_65536) \
+	X(32, growing, TAPE_REALLOC) X(32, fixed8, TAPE_FIXED_256) X(32, fixed16, TAPE_FIXED_65536) \
+	X(64, growing, TAPE_REALLOC) X(64, fixed8, TAPE_FIXED_256) X(64, fixed16, TAPE_FIXED_65536)
+
+#define DECLARE_RUN_PROGRAM(bits, tape, kind) run_function run_program_cell##bits##_##tape;
+FOR_EACH_VARIANT(DECLARE_RUN_PROGRAM)
+#undef DECLARE_RUN_PROGRAM
+
+#endif
@@ -0,0 +1,126 @@
+/*
+ * Vectorised skip loops.  The cells a vector covers are compared against zero
+ * a byte at a time, the byte mask is narrowed down to one bit per zero cell,
+ * and then masked with the lanes which the stride actually lands on.  Each
+ * iteration moves along by a whole number of strides so that the lane mask
+ * stays the same throughout.
+ */
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "skip.h"
+
+#if defined(__GNUC__) && defined(__x86_64__)
+
+#include <immintrin.h>
+
+typedef size_t skip_kernel(cell_int const *cells, size_t pos, size_t stride, bool backward, size_t extent);
+
+/*
+ * Gets the mask of byte lanes (one bit per byte, at the first byte of each
+ * cell) which a scan with the given stride looks at.  Backward scans look at
+ * a vector which ends at the current position.
+ */
+static uint32_t lane_mask(size_t vector_cells, size_t stride, bool backward) {
+	uint32_t mask = 0;
+	for (size_t cell = 0; cell < vector_cells; cell += stride) {
+		size_t lane = backward ? vector_cells - 1 - cell : cell;
+		mask |= (uint32_t)1 << (lane * sizeof(cell_int));
+	}
+	return mask;
+}
+
+// Turns a mask of zero bytes into a mask of zero cells, at the first byte of each
+static uint32_t zero_cells(uint32_t bytes) {
+	if (sizeof(cell_int) >= 2) bytes &= bytes >> 1;
+	if (sizeof(cell_int) >= 4) bytes &= bytes >> 2;
+	if (sizeof(cell_int) >= 8) bytes &= bytes >> 4;
+	return bytes;
+}
+
+/*
+ * The body of a kernel, parametrised on the vector width.  Stops once the
+ * next vector would hang off either end of the tape.
+ */
+#define SKIP_KERNEL_BODY(VECTOR_BYTES, LOAD_ZERO_MASK) do { \
+	enum { VECTOR_CELLS = VECTOR_BYTES / sizeof(cell_int) }; \
+	uint32_t lanes = lane_mask(VECTOR_CELLS, stride, backward); \
+	size_t step = (VECTOR_CELLS + stride - 1) / stride * stride; \
+	if (!backward) { \
+		while (pos + VECTOR_CELLS <= extent) { \
+			uint32_t hits = zero_cells(LOAD_ZERO_MASK(cells + pos)) & lanes; \
+			if (hits) \
+				return pos + (size_t)__builtin_ctz(hits) / sizeof(cell_int); \
+			pos += step; \
+		} \
+	} else { \
+		while (pos >= VECTOR_CELLS - 1) { \
+			size_t base = pos - (VECTOR_CELLS - 1); \
+			uint32_t hits = zero_cells(LOAD_ZERO_MASK(cells + base)) & lanes; \
+			if (hits) \
+				return base + (size_t)(31 - __builtin_clz(hits)) / sizeof(cell_int); \
+			if (pos < step) \
+				break; \
+			pos -= step; \
+		} \
+	} \
+	return pos; \
+} while (0)
+
+static uint32_t zero_mask_sse2(cell_int const *at) {
+	__m128i vector = _mm_loadu_si128((__m128i const*)at);
+	return (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(vector, _mm_setzero_si128()));
+}
+
+static size_t skip_sse2(cell_int const *cells, size_t pos, size_t stride, bool backward, size_t extent) {
+	SKIP_KERNEL_BODY(16, zero_mask_sse2);
+}
+
+__attribute__((target("avx2")))
+static uint32_t zero_mask_avx2(cell_int const *at) {
+	__m256i vector = _mm256_loadu_si256((__m256i const*)at);
+	return (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(vector, _mm256_setzero_si256()));
+}
+
+__attribute__((target("avx2")))
+static size_t skip_avx2(cell_int const *cells, size_t pos, size_t stride, bool backward, size_t extent) {
+	SKIP_KERNEL_BODY(32, zero_mask_avx2);
+}
+
+#undef SKIP_KERNEL_BODY
+
+static skip_kernel *kernel;
+static size_t vector_cells;
+
+/*
+ * Picks the kernel before main, so that it's never written to while
+ * --batch has threads reading it.
+ */
+__attribute__((constructor))
+static void pick_kernel(void) {
+	// Constructors can run before the CPU has been checked
+	__builtin_cpu_init();
+	bool avx2 = __builtin_cpu_supports("avx2");
+	kernel = avx2 ? skip_avx2 : skip_sse2;
+	vector_cells = (avx2 ? 32 : 16) / sizeof(cell_int);
+}
+
+size_t skip_scan(cell_int const *cells, size_t pos, ssize_t stride, size_t extent) {
+	// Strides wider than a vector would only ever look at one lane
+	size_t distance = stride < 0 ? -(size_t)stride : (size_t)stride;
+	if (distance > vector_cells / 2)
+		return pos;
+
+	return kernel(cells, pos, distance, stride < 0, extent);
+}
+
+#else // no vector kernels
+
+size_t skip_scan(cell_int const *cells, size_t pos, ssize_t stride, size_t extent) {
+	(void)cells;
+	(void)stride;
+	(void)extent;
+	return pos;
+}
+
+#endif
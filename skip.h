@@ -0,0 +1,24 @@
+#ifndef USING_SKIP_H
+#define USING_SKIP_H
+
+/*
+ * Vectorised scanning for skip loops like [>] and [<<<].
+ */
+#include <stddef.h>
+#include <sys/types.h>
+
+#include "brainfuck.h"
+
+// Widest stride which any of the vector kernels can speed up
+#define SKIP_MAX_VECTOR_STRIDE (16 / (ssize_t)sizeof(cell_int))
+
+/*
+ * Scans cells at pos, pos + stride, pos + 2*stride... for a zero, never
+ * looking outside of [0, extent).  Returns the position of the first zero
+ * found, or a position on the same stride from which the caller has to carry
+ * on scanning one cell at a time (e.g. near the ends of the tape, or if no
+ * vector unit can handle the stride).
+ */
+size_t skip_scan(cell_int const *cells, size_t pos, ssize_t stride, size_t extent);
+
+#endif
@@ -0,0 +1,134 @@
+/*
+ * Tapes reserved up front in virtual memory.
+ *
+ * A large range of address space is mapped with no access rights, and pages
+ * are committed a chunk at a time from a SIGSEGV handler as the program first
+ * touches them.  Since the tape can never move or run out (short of running
+ * into the guard chunks at either end), there is no need for bounds checks.
+ *
+ * Nothing here depends on the width of a cell, so there is only one copy of
+ * this shared by all of the variants, and so only one SIGSEGV handler.
+ *
+ * With --batch, tapes are reserved and released on several threads while
+ * others fault.  A lock keeps reservations from taking the same slot, and the
+ * handler (which can't take the lock) reads each slot's start atomically.
+ */
+#define _DEFAULT_SOURCE  // For MAP_ANONYMOUS and madvise
+
+#include <pthread.h>
+#include <signal.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+
+#include "tape.h"
+
+#define TAPE_VM_RESERVE ((size_t)1 << 36)  // Bytes of address space per tape
+#define TAPE_VM_CHUNK ((size_t)2 << 20)    // Committed at a time; the size of a huge page
+#define TAPE_VM_GUARD TAPE_VM_CHUNK        // Never committed, at each end of the tape
+
+typedef struct {
+	_Atomic(char *) start;  // Chunk-aligned, TAPE_VM_RESERVE bytes with the guards, or NULL
+	void *mapping;  // As returned by mmap, or NULL if the slot is free
+} vm_region;
+
+static vm_region regions[TAPE_VM_MAX_TAPES];
+static pthread_mutex_t regions_lock = PTHREAD_MUTEX_INITIALIZER;
+static struct sigaction previous_handler;
+static bool handler_installed;
+
+static void fail(char const *message) {
+	// Only async-signal-safe functions from here
+	write(STDERR_FILENO, message, strlen(message));
+	_exit(2);
+}
+
+static void commit_on_fault(int sig, siginfo_t *info, void *context) {
+	(void)sig;
+	(void)context;
+	char *address = info->si_addr;
+
+	for (size_t i = 0; i < TAPE_VM_MAX_TAPES; i++) {
+		char *start = atomic_load(&regions[i].start);
+		if (!start)
+			continue;
+		char *end = start + TAPE_VM_RESERVE;
+		if (address < start || address >= end)
+			continue;
+
+		if (address < start + TAPE_VM_GUARD || address >= end - TAPE_VM_GUARD)
+			fail("brainfuck: Ran off the end of the tape\n");
+
+		char *chunk = start + (size_t)(address - start) / TAPE_VM_CHUNK * TAPE_VM_CHUNK;
+		if (mprotect(chunk, TAPE_VM_CHUNK, PROT_READ | PROT_WRITE))
+			fail("brainfuck: Can't commit memory for the tape\n");
+		return;
+	}
+
+	// Not one of ours: put things back the way they were and let it fault again
+	sigaction(SIGSEGV, &previous_handler, NULL);
+}
+
+char *tape_vm_reserve(bool huge_pages, size_t *usable_bytes, void **reservation) {
+	// Reserve an extra chunk so the start can be aligned for huge pages
+	size_t size = TAPE_VM_RESERVE + TAPE_VM_CHUNK;
+	char *mapping = mmap(NULL, size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+	if (mapping == MAP_FAILED)
+		return NULL;
+
+	char *start = (char*)(((uintptr_t)mapping + TAPE_VM_CHUNK - 1) & ~(uintptr_t)(TAPE_VM_CHUNK - 1));
+#ifdef MADV_HUGEPAGE
+	if (huge_pages)
+		madvise(start, TAPE_VM_RESERVE, MADV_HUGEPAGE);
+#else
+	(void)huge_pages;
+#endif
+
+	pthread_mutex_lock(&regions_lock);
+	vm_region *region = NULL;
+	for (size_t i = 0; i < TAPE_VM_MAX_TAPES && !region; i++) {
+		if (!regions[i].mapping)
+			region = &regions[i];
+	}
+
+	if (region && !handler_installed) {
+		struct sigaction action = {
+			.sa_sigaction = commit_on_fault,
+			.sa_flags = SA_SIGINFO,
+		};
+		sigemptyset(&action.sa_mask);
+		if (sigaction(SIGSEGV, &action, &previous_handler))
+			region = NULL;
+		else
+			handler_installed = true;
+	}
+
+	if (!region) {
+		pthread_mutex_unlock(&regions_lock);
+		munmap(mapping, size);
+		return NULL;
+	}
+
+	region->mapping = mapping;
+	atomic_store(&region->start, start);
+	pthread_mutex_unlock(&regions_lock);
+
+	*usable_bytes = TAPE_VM_RESERVE - 2 * TAPE_VM_GUARD;
+	*reservation = mapping;
+	return start + TAPE_VM_GUARD;
+}
+
+void tape_vm_release(void *reservation) {
+	pthread_mutex_lock(&regions_lock);
+	for (size_t i = 0; i < TAPE_VM_MAX_TAPES; i++) {
+		if (regions[i].mapping == reservation) {
+			atomic_store(&regions[i].start, NULL);
+			regions[i].mapping = NULL;
+		}
+	}
+	pthread_mutex_unlock(&regions_lock);
+	munmap(reservation, TAPE_VM_RESERVE + TAPE_VM_CHUNK);
+}
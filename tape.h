@@ -0,0 +1,245 @@
+#ifndef USING_TAPE_H
+#define USING_TAPE_H
+
+/*
+ * The brainfuck tape, shared between the execution engines.
+ */
+#include <limits.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <err.h>
+#include <sys/types.h>
+
+#include "brainfuck.h"
+#include "interpreter.h"
+#include "skip.h"
+
+/*
+ * Reserves address space for a tape in virtual memory, to be committed as the
+ * program touches it.  Returns the part of it which the tape can use (between
+ * the guards), or NULL if it can't be reserved.  (Shared between variants.)
+ */
+char *tape_vm_reserve(bool huge_pages, size_t *usable_bytes, void **reservation);
+void tape_vm_release(void *reservation);
+
+// How many of them there can be at once
+#define TAPE_VM_MAX_TAPES 64
+
+#ifdef FIXED_TAPE_SIZE
+// One for every position, as offsets from the position wrap around with it
+#define FIXED_TAPE_CELLS ((size_t)(FIXED_TAPE_SIZE)-1 + 1)
+#define TAPE_INDEX(pos, offset) ((FIXED_TAPE_SIZE)((pos) + (offset)))
+
+typedef struct {
+	FIXED_TAPE_SIZE pos;
+	cell_int *restrict cells;
+} tape_struct;
+#else
+typedef struct {
+	size_t back_size;  // Amount of tape corresponding to negative offsets (used for smarter reallocation purposes)
+	size_t front_size; // Amount of tape corresponding to positive offsets (used for smarter reallocation purposes)
+	size_t pos;
+	cell_int *restrict cells;
+	void *reservation;  // For TAPE_VM tapes, the whole mapping (guards included)
+	size_t reallocations;  // Times the tape has had to grow
+#ifndef NDEBUG
+	size_t bound_upper, bound_lower;
+#endif
+} tape_struct;
+
+#define TAPE_INDEX(pos, offset) ((pos) + (offset))
+#endif
+
+// Number of cells which the tape position can be moved over
+inline static size_t tape_extent(tape_struct const *restrict tape) {
+#ifdef FIXED_TAPE_SIZE
+	(void)tape;
+	return FIXED_TAPE_CELLS;
+#else
+	return tape->back_size + tape->front_size;
+#endif
+}
+
+#ifndef FIXED_TAPE_SIZE
+inline static void tape_ensure_space(tape_struct *restrict tape, ssize_t pos, interpreter_meta *meta) {
+	if (pos + meta->lowest_negative_skip < 0) {
+		pos += meta->lowest_negative_skip;  // Always let skips skip without bounds checking
+		size_t old_back_size = tape->back_size;
+		while (pos < 0) {
+			pos += tape->back_size;
+			tape->back_size *= 2;
+		}
+		size_t extra_size = tape->back_size - old_back_size;
+		size_t total_size = tape->back_size + tape->front_size;
+		tape->cells = realloc(tape->cells, total_size * sizeof *tape->cells);
+		tape->reallocations++;
+		memmove(tape->cells + extra_size, tape->cells, (tape->front_size + old_back_size) * sizeof *tape->cells);
+		memset(tape->cells, 0, extra_size * sizeof *tape->cells);
+
+		tape->pos += extra_size;
+#ifndef NDEBUG
+		tape->bound_upper += extra_size;
+		// tape->bound_lower += extra_size; // XXX assuming checking left means bound_lower will be overwritten
+#endif
+	} else if (pos + meta->highest_positive_skip >= (ssize_t)(tape->back_size + tape->front_size)) {
+		pos += meta->highest_positive_skip;  // Always let skips skip without bounds checking
+		size_t old_front_size = tape->front_size;
+
+		size_t total_size = tape->front_size + tape->back_size;
+		while ((size_t)pos >= total_size) {
+			total_size += tape->front_size;
+			tape->front_size *= 2;
+		}
+
+		size_t extra_size = tape->front_size - old_front_size;
+		tape->cells = realloc(tape->cells, total_size * sizeof *tape->cells);
+		tape->reallocations++;
+		memset(tape->cells + old_front_size + tape->back_size, 0, extra_size * sizeof *tape->cells);
+	}
+}
+#endif
+
+inline static void tape_init(tape_struct *restrict tape, interpreter_meta *meta) {
+#ifdef FIXED_TAPE_SIZE
+	(void)meta;
+	*tape = (tape_struct) {
+		.pos = 16,
+	};
+	tape->cells = calloc(sizeof *tape->cells, FIXED_TAPE_CELLS);
+#else
+	if (meta->tape_kind != TAPE_REALLOC) {
+		size_t bytes;
+		void *reservation;
+		char *cells = tape_vm_reserve(meta->tape_kind == TAPE_VM_HUGE, &bytes, &reservation);
+		if (!cells)
+			errx(1, "Can't reserve address space for the tape");
+
+		// Start in the middle, so there's as much room to go left as right
+		size_t half = bytes / 2 / sizeof(cell_int);
+		*tape = (tape_struct) {
+			.back_size = half,
+			.front_size = half,
+			.pos = half,
+			.cells = (cell_int*)cells,
+			.reservation = reservation,
+#ifndef NDEBUG
+			.bound_lower = 0,
+			.bound_upper = 2 * half - 1,
+#endif
+		};
+		return;
+	}
+
+	*tape = (tape_struct) {
+		.pos = 16 - meta->lowest_negative_skip,
+		.back_size = 16 - meta->lowest_negative_skip,
+		.front_size = 16 + meta->highest_positive_skip,
+#ifndef NDEBUG
+		.bound_upper = 16 - meta->lowest_negative_skip,
+		.bound_lower = 16 - meta->lowest_negative_skip,
+#endif
+	};
+	tape->cells = calloc(sizeof *tape->cells, tape->front_size + tape->back_size);
+#endif
+}
+
+/*
+ * Moves along the tape in steps of the given stride until reaching a zero.
+ */
+inline static void tape_skip(tape_struct *restrict tape, ssize_t stride) {
+	// Most skips are short, so only set up the vector scan for longer ones
+	for (int i = 0; i < 4 && tape->cells[tape->pos] != 0; i++)
+		tape->pos += stride;
+
+	if (tape->cells[tape->pos] != 0) {
+		tape->pos = skip_scan(tape->cells, tape->pos, stride, tape_extent(tape));
+		while (tape->cells[tape->pos] != 0) {
+			tape->pos += stride;
+		}
+	}
+
+#if !defined(NDEBUG) && !defined(FIXED_TAPE_SIZE)
+	// Only the cell we stopped at is known to be inside the tape now (the
+	// whole of a reserved tape always is)
+	if (!tape->reservation) {
+		if (stride < 0)
+			tape->bound_lower = tape->pos;
+		else
+			tape->bound_upper = tape->pos;
+	}
+#endif
+}
+
+/*
+ * Clears cells along the tape in steps of the given stride until reaching a
+ * zero, which is where the position is left, as [[-]>] does.  The cells are
+ * found with a skip, then cleared all at once.
+ */
+inline static void tape_clear_run(tape_struct *restrict tape, ssize_t stride) {
+#ifdef FIXED_TAPE_SIZE
+	// The position wraps around, so it could come back round to a cell it cleared
+	while (tape->cells[tape->pos] != 0) {
+		tape->cells[tape->pos] = 0;
+		tape->pos += stride;
+	}
+#else
+	size_t start = tape->pos;
+	tape_skip(tape, stride);
+	if (stride == 1) {
+		memset(tape->cells + start, 0, (tape->pos - start) * sizeof *tape->cells);
+	} else if (stride == -1) {
+		memset(tape->cells + tape->pos + 1, 0, (start - tape->pos) * sizeof *tape->cells);
+	} else {
+		for (size_t pos = start; pos != tape->pos; pos += stride)
+			tape->cells[pos] = 0;
+	}
+#endif
+}
+
+/*
+ * Moves cells by the given distance, stepping one cell at a time the other way
+ * until reaching a zero, as [[->+<]<] does.  The first cells moved land past
+ * the run, and are added to what's there; the rest land on cells which have
+ * already moved.  The run is found with a skip, then moved all at once.
+ */
+inline static void tape_shift_run(tape_struct *restrict tape, ssize_t stride, ssize_t distance) {
+#ifdef FIXED_TAPE_SIZE
+	while (tape->cells[tape->pos] != 0) {
+		tape->cells[TAPE_INDEX(tape->pos, distance)] += tape->cells[tape->pos];
+		tape->cells[tape->pos] = 0;
+		tape->pos += stride;
+	}
+#else
+	size_t start = tape->pos;
+	tape_skip(tape, stride);
+	size_t count = stride < 0 ? start - tape->pos : tape->pos - start;
+	size_t low = stride < 0 ? tape->pos + 1 : start;
+
+	size_t gap = distance < 0 ? -(size_t)distance : (size_t)distance;
+	size_t added = count < gap ? count : gap;
+	for (size_t i = 0; i < added; i++) {
+		size_t pos = start + (size_t)((ssize_t)i * stride);
+		tape->cells[pos + distance] += tape->cells[pos];
+	}
+
+	// Then the cells which land inside the run, leaving the ones nothing lands on empty
+	if (count > gap) {
+		cell_int *from = tape->cells + low + (distance < 0 ? gap : 0);
+		memmove(from + distance, from, (count - gap) * sizeof *tape->cells);
+	}
+	memset(tape->cells + (distance > 0 ? low : low + count - added), 0, added * sizeof *tape->cells);
+#endif
+}
+
+inline static void tape_free(tape_struct *restrict tape) {
+#ifndef FIXED_TAPE_SIZE
+	if (tape->reservation) {
+		tape_vm_release(tape->reservation);
+		return;
+	}
+#endif
+	free(tape->cells);
+}
+
+#endif
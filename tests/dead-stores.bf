@@ -0,0 +1,6 @@
+Takes out stores which are overwritten before anything reads them
+,+++[-]>++++++++[<++++++++>-]<+.
+>+++++,.
+>>++++[<++++++++>-]<[-]<.
++[>++>>+<<<[-]]>.
+>>>++++++++++.+++
@@ -0,0 +1,2 @@
+Loops nested a hundred thousand deep
+,>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[>+[.-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<-]<.
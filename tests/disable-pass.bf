@@ -0,0 +1,2 @@
+Passes which are disabled leave the stores they would have taken out
+,+++[-]>++++++++[<++++++++>-]<+.
@@ -0,0 +1,3 @@
+Running out of steps leaves the rest of the program to run
+++++++++[>++++++++<-]>+.
+>++++++++++[<.>-]++++++++++.
@@ -0,0 +1,5 @@
+Runs everything up to the first input while compiling
+++++++++[>++++++++<-]>+.+.
+>+>+>+<<<[>]
+++++++++++.
+,[.,]
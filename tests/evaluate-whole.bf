@@ -0,0 +1,3 @@
+A program with no input is run entirely while compiling
+++++++++[>+++++++++<-]>.<+++++[>++++++<-]>-.+++++++.<
+++++++++[>>++++<<-]>>.
@@ -0,0 +1,2 @@
+Another round of passes writes output which only the first round made known
+,>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++.
@@ -0,0 +1,4 @@
+Prints a line of stars for each step down from the value read in
+The inner loop runs often enough for tiered execution to compile it
+>++++++[>+++++++<-]>>++++++++++<<<,
+[>++++++++++[>.<-]>>.<<<-]
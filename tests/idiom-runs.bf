@@ -0,0 +1,10 @@
+Clears and shifts runs of cells up to the first zero
+++++++++[>++++++++<-]>+>+>++>+++>++++<<<<
+Shift the run right by one walking left
+[[->+<]<]>>
+.>.>.>.>.>.<<<<<
+Shift it back left by two walking right
+[[-<<+>>]>]
+<<<<<<<<.>.>.>.>.>.>.>.
+Clear it walking left
+[[-]<]>.
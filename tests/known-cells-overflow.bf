@@ -0,0 +1,2 @@
+Cells which there's no room to keep track of aren't taken to be zero
+,>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+>+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++.
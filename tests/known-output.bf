@@ -0,0 +1,2 @@
+Writes the output of cells whose values are known all at once
+,[>>[-]<[-]++++++++++[>+++++++++++<-]>+.----.<++++++++++.<.,]
@@ -0,0 +1,2 @@
+Brackets and runs at the edges of the lexer's sixteen byte chunks
+++++++++xxxxx[>++++xxxxxxxxxxx[>++>+++>+++>+<<<<-xxxxxxxxxxxx]>+>+>->>+xxxxxxx[<xxxxxxxxxxxxx]<-xxxxxxxxxxxxxx]yyyyyyyyyyyy>>.>---.+++++++..+++.>>.<-.<.+++.------.--------.>>+.>++.
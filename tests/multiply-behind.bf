@@ -0,0 +1,4 @@
+Bounds checks reach back as far as a multiply does
+,[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>-]
+>+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++.
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<--.
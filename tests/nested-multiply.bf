@@ -0,0 +1,4 @@
+Loops of multiply loops which keep their inner counters
+++++++++>+++++++++<[>[->+>+<<]>>[-<<+>>]<<<-]>>.
+>>++++++++++>+++++++<[>[->+++>+<<]>>[-<<+>>]<<<--]>>.
+>++++++++++.
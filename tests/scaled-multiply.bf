@@ -0,0 +1,4 @@
+Counters stepped by more than one
+++++++++++[-->+++++++++++++<]>.
+<,[+++>>+<<]>>.
+>++++++++++.
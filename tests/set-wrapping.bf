@@ -0,0 +1,2 @@
+A run of cells set at once can wrap round a fixed tape
+<<<<<<<<<<<<<<<<<<<<+>+>+>+>+>+>+>+<<<<<<<[[-]>[-]>[-]>[-]>[-]>[-]>[-]>[-]<<<<<<<]+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++.
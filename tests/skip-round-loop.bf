@@ -0,0 +1,3 @@
+A skip at the start of a loop body can follow the one at the end of it
++[[<],]+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++.
++[[[-]<],]++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++.
@@ -0,0 +1,80 @@
+#ifndef USING_VARIANT_H
+#define USING_VARIANT_H
+
+/*
+ * Everything which depends on the width of a cell or the kind of tape is
+ * compiled once for each variant (see VARIANTS in the Makefile), with CELL_INT,
+ * FIXED_TAPE_SIZE and VARIANT set to suit.  So that all of the copies can be
+ * linked into one executable, their external names get the variant's name
+ * tacked on the end.  Only main.c, io.c and tape.c are shared between them.
+ */
+#define VARIANT_CONCAT2(name, variant) name##_##variant
+#define VARIANT_CONCAT(name, variant) VARIANT_CONCAT2(name, variant)
+
+#ifdef VARIANT
+#define VARIANT_NAME(name) VARIANT_CONCAT(name, VARIANT)
+
+// brainfuck.c
+#define alloc_bf_op VARIANT_NAME(alloc_bf_op)
+#define insert_bf_ops VARIANT_NAME(insert_bf_ops)
+#define remove_bf_ops VARIANT_NAME(remove_bf_ops)
+#define bf_arena_alloc VARIANT_NAME(bf_arena_alloc)
+#define bf_arena_resize VARIANT_NAME(bf_arena_resize)
+#define bf_arena_release VARIANT_NAME(bf_arena_release)
+#define bf_arena_free VARIANT_NAME(bf_arena_free)
+#define grow_stack VARIANT_NAME(grow_stack)
+#define source_range_union VARIANT_NAME(source_range_union)
+
+// parser.c, optimizer.c, optimizer_helpers.c and evaluator.c
+#define build_bf_tree VARIANT_NAME(build_bf_tree)
+#define optimize_root VARIANT_NAME(optimize_root)
+#define optimize_loop VARIANT_NAME(optimize_loop)
+#define add_bounds_checks VARIANT_NAME(add_bounds_checks)
+#define defer_moves VARIANT_NAME(defer_moves)
+#define remove_dead_stores VARIANT_NAME(remove_dead_stores)
+#define write_known_output VARIANT_NAME(write_known_output)
+#define count_bf_ops VARIANT_NAME(count_bf_ops)
+#define evaluate_prefix VARIANT_NAME(evaluate_prefix)
+#define ensures_zero VARIANT_NAME(ensures_zero)
+#define ensures_nonzero VARIANT_NAME(ensures_nonzero)
+#define writes_cell VARIANT_NAME(writes_cell)
+#define moves_tape VARIANT_NAME(moves_tape)
+#define expects_nonzero VARIANT_NAME(expects_nonzero)
+#define get_final_offset VARIANT_NAME(get_final_offset)
+#define get_max_offset VARIANT_NAME(get_max_offset)
+#define get_min_offset VARIANT_NAME(get_min_offset)
+#define get_loop_info VARIANT_NAME(get_loop_info)
+#define offset_might_be_accessed VARIANT_NAME(offset_might_be_accessed)
+#define cell_inverse VARIANT_NAME(cell_inverse)
+
+// flattener.c and debug.c
+#define flatten_bf VARIANT_NAME(flatten_bf)
+#define source_map_find VARIANT_NAME(source_map_find)
+#define bytecode_op_size VARIANT_NAME(bytecode_op_size)
+#define bytecode_length VARIANT_NAME(bytecode_length)
+#define print_bf_op VARIANT_NAME(print_bf_op)
+#define print_flattened VARIANT_NAME(print_flattened)
+#define print_source_range VARIANT_NAME(print_source_range)
+#define flattened_op_name VARIANT_NAME(flattened_op_name)
+
+// The execution engines
+#define execute_bf VARIANT_NAME(execute_bf)
+#define execute_bf_threaded VARIANT_NAME(execute_bf_threaded)
+#define execute_bf_jit VARIANT_NAME(execute_bf_jit)
+#define execute_bf_tiered VARIANT_NAME(execute_bf_tiered)
+#define execute_bf_counting VARIANT_NAME(execute_bf_counting)
+#define execute_bf_profiling VARIANT_NAME(execute_bf_profiling)
+#define jit_compile VARIANT_NAME(jit_compile)
+#define jit_run VARIANT_NAME(jit_run)
+#define jit_free VARIANT_NAME(jit_free)
+#define skip_scan VARIANT_NAME(skip_scan)
+#define profile_init VARIANT_NAME(profile_init)
+#define profile_free VARIANT_NAME(profile_free)
+#define print_profile VARIANT_NAME(print_profile)
+#define print_annotated_source VARIANT_NAME(print_annotated_source)
+
+// run.c
+#define run_program VARIANT_NAME(run_program)
+#endif
+
+#endif